@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <sstream>
+
+#include "frontend/tokenizer.hpp"
+#include "frontend/parser.hpp"
+#include "core/common_feature_adoption_plan_generation_engine.hpp"
+#include "core/program_representation.hpp"
+#include "preprocessing/preprocessor.hpp"
+#include "backend/finalizer.hpp"
+#include "synthetic_inputs.hpp"
+
+static void BM_CommonFeatureAdoptionPlanGenerationEngine_WideUnion(benchmark::State& state) {
+    ProjectFileStructure project = make_project_with_large_overload_set(state.range(0));
+    FunctionCall function_call = make_synthetic_function_call("process", 1);
+    TypeSignature wide_union_type = TypeSignatureFactory::make_custom_type("WideUnion", { });
+    for (auto _ : state) {
+        state.PauseTiming();
+        TypeDefinitionsRegister type_definitions_register(project);
+        FunctionDefinitionsRegister function_definitions_register(type_definitions_register, project);
+        CommonFeatureAdoptionPlanGenerationEngine engine(function_definitions_register, type_definitions_register);
+        state.ResumeTiming();
+        CommonFeatureAdoptionPlanDescriptor descriptor = 
+            engine.generate_common_feature_adoption_plan_descriptor(function_call, { wide_union_type });
+        benchmark::DoNotOptimize(descriptor.return_type);
+    }
+}
+
+static void BM_Finalizer_GenerateLLVMIR(benchmark::State& state) {
+    Tokenizer tokenizer(std::istringstream { make_synthetic_source(state.range(0)) });
+    Parser parser(tokenizer.tokenize());
+    ProjectFileStructure project_file_structure({ parser.parse_everything() });
+    ProgramRepresentation program_representation(project_file_structure);
+    PreProcessor preprocessor(program_representation);
+    preprocessor.preprocess_packages_typename_conflicts();
+    preprocessor.preprocess_type_definitions();
+    preprocessor.preprocess_function_definitions();
+    std::streambuf* console_output = std::cout.rdbuf(nullptr);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Finalizer finalizer(program_representation);
+        state.ResumeTiming();
+        finalizer.generate_llvm_ir();
+    }
+    std::cout.rdbuf(console_output);
+    std::cout.clear();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_CommonFeatureAdoptionPlanGenerationEngine_WideUnion)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Finalizer_GenerateLLVMIR)->RangeMultiplier(8)->Range(8, 512)->Unit(benchmark::kMillisecond);
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "frontend/tokenizer.hpp"
+#include "frontend/mapped_tokenizer.hpp"
+#include "frontend/parser.hpp"
+#include "misc/ast_arena.hpp"
+#include "synthetic_inputs.hpp"
+
+static void BM_Tokenizer_Tokenize(benchmark::State& state) {
+    std::string source = make_synthetic_source(state.range(0));
+    for (auto _ : state) {
+        Tokenizer tokenizer(std::istringstream { source });
+        TokenizedFile tokenized_file = tokenizer.tokenize();
+        benchmark::DoNotOptimize(tokenized_file.tokens.data());
+    }
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+static void BM_MappedTokenizer_Tokenize(benchmark::State& state) {
+    std::string source = make_synthetic_source(state.range(0));
+    std::filesystem::path source_path = std::filesystem::temp_directory_path() / "basalt_mapped_tokenizer_benchmark.bt";
+    std::ofstream(source_path) << source;
+    SourceFilesRegistry source_files_registry;
+    SourceFilesRegistry::FileId file_id = source_files_registry.map_source_file(source_path.string());
+    for (auto _ : state) {
+        MappedTokenizer tokenizer(source_files_registry, file_id);
+        TokenizedFile tokenized_file = tokenizer.tokenize();
+        benchmark::DoNotOptimize(tokenized_file.tokens.data());
+    }
+    state.SetBytesProcessed(state.iterations() * source.size());
+    std::filesystem::remove(source_path);
+}
+
+static void BM_Parser_ParseEverything(benchmark::State& state) {
+    std::string source = make_synthetic_source(state.range(0));
+    Tokenizer tokenizer(std::istringstream { source });
+    TokenizedFile tokenized_file = tokenizer.tokenize();
+    for (auto _ : state) {
+        AstArena ast_arena;
+        AstArena::Scope ast_arena_scope(ast_arena);
+        Parser parser(tokenized_file);
+        FileRepresentation file_representation = parser.parse_everything();
+        benchmark::DoNotOptimize(file_representation.func_defs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * tokenized_file.tokens.size());
+}
+
+static void run_expression_chain_parsing_benchmark(benchmark::State& state, const std::vector<std::string>& operators) {
+    std::string source = make_synthetic_expression_chain(state.range(0), operators);
+    Tokenizer tokenizer(std::istringstream { source });
+    TokenizedFile tokenized_file = tokenizer.tokenize();
+    for (auto _ : state) {
+        AstArena ast_arena;
+        AstArena::Scope ast_arena_scope(ast_arena);
+        Parser parser(tokenized_file);
+        Expression expression = parser.parse_expression();
+        benchmark::DoNotOptimize(expression);
+    }
+    state.SetItemsProcessed(state.iterations() * tokenized_file.tokens.size());
+    state.SetComplexityN(state.range(0));
+}
+
+static void BM_Parser_ParseArithmeticChain(benchmark::State& state) {
+    run_expression_chain_parsing_benchmark(state, { "+", "*", "-", "/", "%" });
+}
+
+static void BM_Parser_ParseBooleanChain(benchmark::State& state) {
+    run_expression_chain_parsing_benchmark(state, { "<", "&&", "==", "||", ">=", "!=" });
+}
+
+BENCHMARK(BM_Tokenizer_Tokenize)->RangeMultiplier(8)->Range(8, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MappedTokenizer_Tokenize)->RangeMultiplier(8)->Range(8, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parser_ParseEverything)->RangeMultiplier(8)->Range(8, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parser_ParseArithmeticChain)->RangeMultiplier(4)->Range(16, 16384)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Parser_ParseBooleanChain)->RangeMultiplier(4)->Range(16, 16384)->Complexity()->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+#include <sstream>
+
+#include "frontend/tokenizer.hpp"
+#include "frontend/parser.hpp"
+#include "core/generics_instantiation_engine.hpp"
+#include "synthetic_inputs.hpp"
+
+// a single generic function (64 non generic statements pairs) instantiated once per element type, 
+// like a container used with many different types: every instantiation is kept alive until the 
+// end of the iteration, so that the memory manager reports the footprint of all of them together.
+static void BM_GenericsInstantiationEngine_InstantiateGenericFunction(benchmark::State& state) {
+    Tokenizer tokenizer(std::istringstream { make_synthetic_generic_function_source(64) });
+    Parser parser(tokenizer.tokenize());
+    FunctionDefinition generic_function = parser.parse_everything().func_defs.front();
+    std::vector<TypeSignature> element_types;
+    for (int64_t index = 0; index < state.range(0); index++) {
+        element_types.push_back(TypeSignatureFactory::make_custom_type(make_synthetic_struct_name(index), { }));
+    }
+    for (auto _ : state) {
+        std::vector<FunctionDefinition::Ref> instantiated_functions;
+        for (const TypeSignature& element_type : element_types) {
+            GenericsInstantiationEngine engine({ GenericSubstitutionRule { "T", element_type } });
+            instantiated_functions.push_back(engine.instantiate_generic_function(generic_function, "wrap"));
+        }
+        benchmark::DoNotOptimize(instantiated_functions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * element_types.size());
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_GenericsInstantiationEngine_InstantiateGenericFunction)->RangeMultiplier(2)->Range(25, 200)->Complexity()->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// every allocation is prefixed with its own size and with the tracking session it belongs to, so that 
+// the amount of memory in use (and its peak) can be tracked while google-benchmark runs its memory-measuring 
+// iterations; blocks allocated outside of the current session are ignored when released.
+
+struct AllocationHeader {
+    size_t size;
+    size_t tracking_session;
+};
+
+static constexpr size_t allocation_header_size = 
+    (sizeof(AllocationHeader) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+static std::atomic<bool> is_tracking_allocations = false;
+static std::atomic<size_t> current_tracking_session = 0;
+static std::atomic<size_t> allocations_counter = 0;
+static std::atomic<size_t> allocated_bytes_counter = 0;
+static std::atomic<size_t> bytes_in_use = 0;
+static std::atomic<size_t> peak_bytes_in_use = 0;
+
+void* operator new(size_t size) {
+    void* address = std::malloc(size + allocation_header_size);
+    if (address == nullptr) {
+        throw std::bad_alloc();
+    }
+    bool is_tracked = is_tracking_allocations.load(std::memory_order_relaxed);
+    *static_cast<AllocationHeader*>(address) = AllocationHeader { 
+        size, is_tracked ? current_tracking_session.load(std::memory_order_relaxed) : 0 
+    };
+    if (is_tracked) {
+        allocations_counter.fetch_add(1, std::memory_order_relaxed);
+        allocated_bytes_counter.fetch_add(size, std::memory_order_relaxed);
+        size_t current_bytes_in_use = bytes_in_use.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t current_peak = peak_bytes_in_use.load(std::memory_order_relaxed);
+        while (current_bytes_in_use > current_peak && 
+            !peak_bytes_in_use.compare_exchange_weak(current_peak, current_bytes_in_use, std::memory_order_relaxed));
+    }
+    return static_cast<char*>(address) + allocation_header_size;
+}
+
+void operator delete(void* address) noexcept {
+    if (address == nullptr) {
+        return;
+    }
+    void* allocation = static_cast<char*>(address) - allocation_header_size;
+    const AllocationHeader& header = *static_cast<AllocationHeader*>(allocation);
+    if (header.tracking_session != 0 && header.tracking_session == current_tracking_session.load(std::memory_order_relaxed)) {
+        bytes_in_use.fetch_sub(header.size, std::memory_order_relaxed);
+    }
+    std::free(allocation);
+}
+
+void operator delete(void* address, size_t) noexcept {
+    operator delete(address);
+}
+
+class PeakMemoryManager : public benchmark::MemoryManager {
+
+    public:
+        void Start() override {
+            allocations_counter = 0;
+            allocated_bytes_counter = 0;
+            bytes_in_use = 0;
+            peak_bytes_in_use = 0;
+            current_tracking_session++;
+            is_tracking_allocations = true;
+        }
+
+        void Stop(Result& result) override {
+            is_tracking_allocations = false;
+            result.num_allocs = allocations_counter;
+            result.max_bytes_used = peak_bytes_in_use;
+            result.total_allocated_bytes = allocated_bytes_counter;
+        }
+
+        // google-benchmark versions prior to 1.8 only declare this overload as pure virtual
+        void Stop(Result* result) {
+            Stop(*result);
+        }
+};
+
+static PeakMemoryManager peak_memory_manager;
+static const bool is_peak_memory_manager_registered = [](){
+    benchmark::RegisterMemoryManager(&peak_memory_manager);
+    return true;
+}();
\ No newline at end of file
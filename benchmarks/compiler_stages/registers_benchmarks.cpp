@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include "core/type_definitions_register.hpp"
+#include "core/function_definitions_register.hpp"
+#include "synthetic_inputs.hpp"
+
+static void BM_FunctionDefinitionsRegister_RetrieveFunctionDefinition(benchmark::State& state) {
+    size_t overloads_count = state.range(0);
+    ProjectFileStructure project = make_project_with_large_overload_set(overloads_count);
+    FunctionCall function_call = make_synthetic_function_call("process", 1);
+    for (auto _ : state) {
+        state.PauseTiming();
+        TypeDefinitionsRegister type_definitions_register(project);
+        FunctionDefinitionsRegister function_definitions_register(type_definitions_register, project);
+        state.ResumeTiming();
+        for (size_t index = 0; index < overloads_count; index++) {
+            TypeSignature arg_type = TypeSignatureFactory::make_custom_type(make_synthetic_struct_name(index), { });
+            benchmark::DoNotOptimize(function_definitions_register.retrieve_function_definition(function_call, { arg_type }));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * overloads_count);
+}
+
+static void BM_FunctionDefinitionsRegister_RetrieveFunctionDefinition_Cached(benchmark::State& state) {
+    size_t overloads_count = state.range(0);
+    ProjectFileStructure project = make_project_with_large_overload_set(overloads_count);
+    FunctionCall function_call = make_synthetic_function_call("process", 1);
+    TypeDefinitionsRegister type_definitions_register(project);
+    FunctionDefinitionsRegister function_definitions_register(type_definitions_register, project);
+    std::vector<TypeSignature> arg_types;
+    for (size_t index = 0; index < overloads_count; index++) {
+        arg_types.push_back(TypeSignatureFactory::make_custom_type(make_synthetic_struct_name(index), { }));
+    }
+    for (auto _ : state) {
+        for (const TypeSignature& arg_type : arg_types) {
+            benchmark::DoNotOptimize(function_definitions_register.retrieve_function_definition(function_call, { arg_type }));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * overloads_count);
+}
+
+static void BM_TypeDefinitionsRegister_GetFullyQualifiedTypesignatureName(benchmark::State& state) {
+    ProjectFileStructure project = make_project_with_generic_box();
+    TypeSignature nested_box_type = make_nested_box_type(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        TypeDefinitionsRegister type_definitions_register(project);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(type_definitions_register.get_fully_qualified_typesignature_name(nested_box_type));
+    }
+}
+
+static void BM_TypeDefinitionsRegister_GetFullyQualifiedTypesignatureName_Cached(benchmark::State& state) {
+    ProjectFileStructure project = make_project_with_generic_box();
+    TypeSignature nested_box_type = make_nested_box_type(state.range(0));
+    TypeDefinitionsRegister type_definitions_register(project);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(type_definitions_register.get_fully_qualified_typesignature_name(nested_box_type));
+    }
+}
+
+BENCHMARK(BM_FunctionDefinitionsRegister_RetrieveFunctionDefinition)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FunctionDefinitionsRegister_RetrieveFunctionDefinition_Cached)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TypeDefinitionsRegister_GetFullyQualifiedTypesignatureName)->DenseRange(1, 16, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TypeDefinitionsRegister_GetFullyQualifiedTypesignatureName_Cached)->DenseRange(1, 16, 5)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
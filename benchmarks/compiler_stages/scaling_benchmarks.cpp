@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <map>
+
+#include "frontend/mapped_tokenizer.hpp"
+#include "frontend/parser.hpp"
+#include "core/program_representation.hpp"
+#include "preprocessing/preprocessor.hpp"
+#include "backend/finalizer.hpp"
+#include "misc/ast_arena.hpp"
+#include "project_generator/synthetic_project_generator.hpp"
+
+// scaling curves: every benchmark is parameterized on the number of packages of a synthetic
+// project (see `SyntheticProjectGenerator`), the complexity is then fitted against its lines of code.
+
+struct SyntheticProjectFixture {
+    std::vector<std::string> file_paths;
+    std::vector<FileRepresentation> file_representations;
+    size_t source_lines = 0;
+};
+
+static const SyntheticProjectFixture& get_synthetic_project(size_t packages_count) {
+    static std::map<size_t, SyntheticProjectFixture> synthetic_projects;
+    auto cache_search_outcome = synthetic_projects.find(packages_count);
+    if (cache_search_outcome != synthetic_projects.end()) {
+        return cache_search_outcome->second;
+    }
+    SyntheticProjectSettings settings;
+    settings.packages_count = packages_count;
+    SyntheticProjectGenerator generator(settings);
+    std::filesystem::path output_directory = std::filesystem::temp_directory_path() / 
+        ("basalt_synthetic_project_" + std::to_string(packages_count));
+    SyntheticProjectFixture project;
+    project.file_paths = generator.write_project(output_directory.string());
+    SourceFilesRegistry source_files_registry;
+    for (const std::string& file_path : project.file_paths) {
+        MappedTokenizer tokenizer(source_files_registry, source_files_registry.map_source_file(file_path));
+        TokenizedFile tokenized_file = tokenizer.tokenize();
+        project.source_lines += tokenized_file.tokens.empty() ? 0 : tokenized_file.tokens.back().line_number;
+        Parser parser(tokenized_file);
+        project.file_representations.push_back(parser.parse_everything());
+    }
+    return synthetic_projects.insert({ packages_count, project }).first->second;
+}
+
+static void preprocess(ProgramRepresentation& program_representation) {
+    PreProcessor preprocessor(program_representation);
+    preprocessor.preprocess_packages_typename_conflicts();
+    preprocessor.preprocess_type_definitions();
+    preprocessor.preprocess_function_definitions();
+}
+
+static void BM_Scaling_TokenizeAndParse(benchmark::State& state) {
+    const SyntheticProjectFixture& project = get_synthetic_project(state.range(0));
+    for (auto _ : state) {
+        AstArena ast_arena;
+        AstArena::Scope ast_arena_scope(ast_arena);
+        SourceFilesRegistry source_files_registry;
+        for (const std::string& file_path : project.file_paths) {
+            MappedTokenizer tokenizer(source_files_registry, source_files_registry.map_source_file(file_path));
+            Parser parser(tokenizer.tokenize());
+            FileRepresentation file_representation = parser.parse_everything();
+            benchmark::DoNotOptimize(file_representation.func_defs.data());
+        }
+    }
+    state.SetComplexityN(project.source_lines);
+}
+
+static void BM_Scaling_ProjectFileStructure(benchmark::State& state) {
+    const SyntheticProjectFixture& project = get_synthetic_project(state.range(0));
+    for (auto _ : state) {
+        ProjectFileStructure project_file_structure(project.file_representations);
+        benchmark::DoNotOptimize(&project_file_structure);
+    }
+    state.SetComplexityN(project.source_lines);
+}
+
+static void BM_Scaling_ProgramRepresentation(benchmark::State& state) {
+    const SyntheticProjectFixture& project = get_synthetic_project(state.range(0));
+    ProjectFileStructure project_file_structure(project.file_representations);
+    for (auto _ : state) {
+        ProgramRepresentation program_representation(project_file_structure);
+        benchmark::DoNotOptimize(&program_representation);
+    }
+    state.SetComplexityN(project.source_lines);
+}
+
+static void BM_Scaling_PreProcessing(benchmark::State& state) {
+    const SyntheticProjectFixture& project = get_synthetic_project(state.range(0));
+    ProjectFileStructure project_file_structure(project.file_representations);
+    for (auto _ : state) {
+        state.PauseTiming();
+        ProgramRepresentation program_representation(project_file_structure);
+        state.ResumeTiming();
+        preprocess(program_representation);
+    }
+    state.SetComplexityN(project.source_lines);
+}
+
+static void BM_Scaling_CodeGeneration(benchmark::State& state) {
+    const SyntheticProjectFixture& project = get_synthetic_project(state.range(0));
+    ProjectFileStructure project_file_structure(project.file_representations);
+    ProgramRepresentation program_representation(project_file_structure);
+    preprocess(program_representation);
+    std::streambuf* console_output = std::cout.rdbuf(nullptr);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Finalizer finalizer(program_representation);
+        state.ResumeTiming();
+        finalizer.generate_llvm_ir();
+    }
+    std::cout.rdbuf(console_output);
+    std::cout.clear();
+    state.SetComplexityN(project.source_lines);
+}
+
+BENCHMARK(BM_Scaling_TokenizeAndParse)->RangeMultiplier(2)->Range(1, 32)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scaling_ProjectFileStructure)->RangeMultiplier(2)->Range(1, 32)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scaling_ProgramRepresentation)->RangeMultiplier(2)->Range(1, 32)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scaling_PreProcessing)->RangeMultiplier(2)->Range(1, 32)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scaling_CodeGeneration)->RangeMultiplier(2)->Range(1, 32)->Complexity()->Unit(benchmark::kMillisecond);
\ No newline at end of file
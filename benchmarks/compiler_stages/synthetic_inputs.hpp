@@ -0,0 +1,136 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "core/project_file_structure.hpp"
+#include "tests_utilities/function_definition_factory.hpp"
+#include "tests_utilities/struct_definition_factory.hpp"
+#include "tests_utilities/union_definition_factory.hpp"
+#include "tests_utilities/typesignature_factory.hpp"
+
+// a single `main` package made of `functions_count` functions, each one calling the previous one;
+// it only relies on the language itself (no imports) so that it can be compiled end-to-end.
+inline std::string make_synthetic_source(size_t functions_count) {
+    std::string source = "package main;\n\n";
+    for (size_t index = 0; index < functions_count; index++) {
+        std::string function_name = "collatz_" + std::to_string(index);
+        std::string previous_call = (index == 0) 
+            ? "0" : "collatz_" + std::to_string(index - 1) + "(x)";
+        source += "func " + function_name + "(seed : Int) -> Int {\n";
+        source += "    var x : Int = seed;\n";
+        source += "    var steps : Int = 0;\n";
+        source += "    while (x != 1 && steps < 100) {\n";
+        source += "        if (x % 2 == 0) { x = x / 2; }\n";
+        source += "        else { x = 3 * x + 1; }\n";
+        source += "        steps = steps + 1;\n";
+        source += "    }\n";
+        source += "    return steps + " + previous_call + ";\n";
+        source += "}\n\n";
+    }
+    source += "func main() -> Int {\n";
+    source += "    return collatz_" + std::to_string(functions_count - 1) + "(27) % 256;\n";
+    source += "}\n";
+    return source;
+}
+
+// a single expression made of `operands_count` identifiers joined by `operators`, used cyclically;
+// operators of mixed priorities force the parser to keep re-associating the chain while reading it.
+inline std::string make_synthetic_expression_chain(size_t operands_count, const std::vector<std::string>& operators) {
+    std::string source = "x0";
+    for (size_t index = 1; index < operands_count; index++) {
+        source += " " + operators[(index - 1) % operators.size()] + " x" + std::to_string(index);
+    }
+    return source + ";";
+}
+
+// a generic function whose body is mostly made of statements that never mention its template 
+// type `T`: only its argument, its return type and its last two statements depend on it.
+inline std::string make_synthetic_generic_function_source(size_t non_generic_statements_count) {
+    std::string source = "package main;\n\n";
+    source += "func wrap<T>(value : T) -> T {\n";
+    for (size_t index = 0; index < non_generic_statements_count; index++) {
+        std::string variable_name = "local_" + std::to_string(index);
+        source += "    var " + variable_name + " : Int = " + std::to_string(index) + " * 3 + 1;\n";
+        source += "    while (" + variable_name + " > 1) { " + variable_name + " = " + variable_name + " / 2; }\n";
+    }
+    source += "    var copy : T = value;\n";
+    source += "    return copy;\n";
+    source += "}\n";
+    return source;
+}
+
+inline std::string make_synthetic_struct_name(size_t index) {
+    return "Struct" + std::to_string(index);
+}
+
+inline FunctionCall make_synthetic_function_call(const std::string& function_name, size_t args_count) {
+    std::vector<Expression> args;
+    for (size_t index = 0; index < args_count; index++) {
+        args.push_back(Identifier { Token { "x", "test.basalt", 1, 1, 1, Token::Type::text } });
+    }
+    return FunctionCall { Token { function_name, "test.basalt", 1, 1, 1, Token::Type::text }, args, { } };
+}
+
+// `structs_count` empty structs, a `process` overload for each of them plus a generic fallback,
+// and a named union `WideUnion` whose alternatives are all the structs.
+inline ProjectFileStructure make_project_with_large_overload_set(size_t structs_count) {
+    FileRepresentation file_representation {
+        .file_metadata = { 
+            .filename = "test.basalt",
+            .packagename = "main",
+            .imports = { },
+        },
+        .type_defs = { },
+        .func_defs = { }
+    };
+    std::vector<TypeSignature> alternatives;
+    for (size_t index = 0; index < structs_count; index++) {
+        std::string struct_name = make_synthetic_struct_name(index);
+        file_representation.type_defs.push_back(StructDefinitionFactory::make_struct_definition(
+            struct_name, "test.basalt", StructDefinitionFactory::no_generics, StructDefinitionFactory::no_fields
+        ));
+        alternatives.push_back(TypeSignatureFactory::make_custom_type(struct_name, { }));
+        file_representation.func_defs.push_back(FunctionDefinitionFactory::make_function_definition(
+            "process", "test.basalt", FunctionDefinitionFactory::no_generics, 
+            { FunctionDefinition::Argument { "x", alternatives.back() } }, 
+            TypeSignatureFactory::Int
+        ));
+    }
+    file_representation.func_defs.push_back(FunctionDefinitionFactory::make_function_definition(
+        "process", "test.basalt", { "T" }, 
+        { FunctionDefinition::Argument { "x", TypeSignatureFactory::T } }, 
+        TypeSignatureFactory::Int
+    ));
+    file_representation.type_defs.push_back(UnionDefinitionFactory::make_union_definition(
+        "WideUnion", "test.basalt", UnionDefinitionFactory::no_generics, alternatives
+    ));
+    return ProjectFileStructure({ file_representation });
+}
+
+// a generic `Box<T>` struct, used to build `Box<Box<...<Int>...>>` signatures of arbitrary depth.
+inline ProjectFileStructure make_project_with_generic_box() {
+    FileRepresentation file_representation {
+        .file_metadata = { 
+            .filename = "test.basalt",
+            .packagename = "main",
+            .imports = { },
+        },
+        .type_defs = {
+            StructDefinitionFactory::make_struct_definition(
+                "Box", "test.basalt", { "T" }, 
+                { StructDefinition::Field { "value", TypeSignatureFactory::T } }
+            )
+        },
+        .func_defs = { }
+    };
+    return ProjectFileStructure({ file_representation });
+}
+
+inline TypeSignature make_nested_box_type(size_t depth) {
+    TypeSignature nested = TypeSignatureFactory::Int;
+    for (size_t level = 0; level < depth; level++) {
+        nested = TypeSignatureFactory::make_custom_type("Box", { nested });
+    }
+    return nested;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include <algorithm>
+
+#include "synthetic_project_generator.hpp"
+
+// usage: basalt_project_generator <output-directory> [--packages N] [--files N] [--imports N] 
+//        [--functions N] [--overloads N] [--generics-depth N] [--union-width N] [--nesting N]
+// the paths of the generated files are printed space-separated, so that they can be fed
+// directly to the compiler: `basalt compile -o out.o -i $(basalt_project_generator ...)`
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc % 2 != 0) {
+        std::cerr << "usage: " << argv[0] << " <output-directory> [--packages N] [--files N] [--imports N] "
+            "[--functions N] [--overloads N] [--generics-depth N] [--union-width N] [--nesting N]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    SyntheticProjectSettings settings;
+    std::map<std::string, size_t*> knobs = {
+        { "--packages",       &settings.packages_count     },
+        { "--files",          &settings.files_per_package  },
+        { "--imports",        &settings.imports_per_file   },
+        { "--functions",      &settings.functions_per_file },
+        { "--overloads",      &settings.overloads_per_name },
+        { "--generics-depth", &settings.generics_depth     },
+        { "--union-width",    &settings.union_width        },
+        { "--nesting",        &settings.statements_nesting },
+    };
+    for (int arg_index = 2; arg_index < argc; arg_index += 2) {
+        auto knob = knobs.find(argv[arg_index]);
+        std::string value = argv[arg_index + 1];
+        bool is_number = !value.empty() && std::all_of(value.begin(), value.end(), ::isdigit);
+        if (knob == knobs.end() || !is_number) {
+            std::cerr << "invalid option: " << argv[arg_index] << " " << value << std::endl;
+            return EXIT_FAILURE;
+        }
+        *knob->second = std::stoul(value);
+    }
+    SyntheticProjectGenerator generator(settings);
+    std::vector<std::string> written_files = generator.write_project(argv[1]);
+    for (size_t file_index = 0; file_index < written_files.size(); file_index++) {
+        std::cout << ((file_index == 0) ? "" : " ") << written_files[file_index];
+    }
+    std::cout << std::endl;
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "synthetic_project_generator.hpp"
+
+static std::string get_package_name(size_t package_index) {
+    return "pkg" + std::to_string(package_index);
+}
+
+// types must have unique names across all the imported packages,
+// hence every definition is suffixed with both the package and the file index.
+static std::string get_file_suffix(size_t package_index, size_t file_index) {
+    return std::to_string(package_index) + "_" + std::to_string(file_index);
+}
+
+static std::string get_tag_name(const std::string& file_suffix, size_t tag_index) {
+    return "Tag" + file_suffix + "_" + std::to_string(tag_index);
+}
+
+static std::string get_work_function_name(const std::string& file_suffix, size_t function_index) {
+    return "work_" + file_suffix + "_" + std::to_string(function_index);
+}
+
+SyntheticProjectGenerator::SyntheticProjectGenerator(const SyntheticProjectSettings& settings)
+    : settings(settings) 
+{
+    this->settings.files_per_package = std::max<size_t>(this->settings.files_per_package, 1);
+    this->settings.functions_per_file = std::max<size_t>(this->settings.functions_per_file, 1);
+}
+
+std::vector<SyntheticSourceFile> SyntheticProjectGenerator::generate_project() const {
+    std::vector<SyntheticSourceFile> source_files;
+    for (size_t package_index = 0; package_index < settings.packages_count; package_index++) {
+        for (size_t file_index = 0; file_index < settings.files_per_package; file_index++) {
+            source_files.push_back(generate_package_file(package_index, file_index));
+        }
+    }
+    source_files.push_back(generate_main_file());
+    return source_files;
+}
+
+std::vector<std::string> SyntheticProjectGenerator::write_project(const std::string& output_directory) const {
+    std::vector<std::string> written_files;
+    for (const SyntheticSourceFile& source_file : generate_project()) {
+        std::filesystem::path file_path = std::filesystem::path(output_directory) / source_file.file_path;
+        std::filesystem::create_directories(file_path.parent_path());
+        std::ofstream(file_path) << source_file.source_code;
+        written_files.push_back(file_path.string());
+    }
+    return written_files;
+}
+
+SyntheticSourceFile SyntheticProjectGenerator::generate_package_file(size_t package_index, size_t file_index) const {
+    std::string source_code = "package " + get_package_name(package_index) + ";\n\n";
+    for (size_t imported_package : get_imported_packages(package_index, file_index)) {
+        source_code += "import " + get_package_name(imported_package) + ";\n";
+    }
+    std::string file_suffix = get_file_suffix(package_index, file_index);
+    source_code += "\n" + generate_type_definitions(file_suffix);
+    source_code += generate_overloaded_functions(file_suffix);
+    for (size_t function_index = 0; function_index < settings.functions_per_file; function_index++) {
+        source_code += generate_work_function(package_index, file_index, function_index);
+    }
+    if (file_index == 0) {
+        source_code += generate_entry_function(package_index);
+    }
+    std::string file_path = get_package_name(package_index) + "/file" + std::to_string(file_index) + ".bt";
+    return SyntheticSourceFile { file_path, source_code };
+}
+
+SyntheticSourceFile SyntheticProjectGenerator::generate_main_file() const {
+    std::string source_code = "package main;\n\n";
+    for (size_t package_index = 0; package_index < settings.packages_count; package_index++) {
+        source_code += "import " + get_package_name(package_index) + ";\n";
+    }
+    source_code += "\nfunc main() -> Int {\n";
+    source_code += "    var total : Int = 0;\n";
+    for (size_t package_index = 0; package_index < settings.packages_count; package_index++) {
+        source_code += "    total = total + " + get_package_name(package_index) + "::entry(" + std::to_string(package_index) + ");\n";
+    }
+    source_code += "    return total % 256;\n";
+    source_code += "}\n";
+    return SyntheticSourceFile { "main/main.bt", source_code };
+}
+
+std::string SyntheticProjectGenerator::generate_type_definitions(const std::string& file_suffix) const {
+    std::string source_code;
+    for (size_t tag_index = 0; tag_index < get_tags_count(); tag_index++) {
+        source_code += "struct " + get_tag_name(file_suffix, tag_index) + " { value : Int; }\n";
+    }
+    if (settings.generics_depth > 0) {
+        source_code += "struct Box" + file_suffix + "<T> { value : T; }\n";
+        source_code += "struct Pair" + file_suffix + "<K, V> { first : K; second : V; }\n";
+    }
+    if (settings.union_width > 1) {
+        source_code += "union Wide" + file_suffix + " = " + get_tag_name(file_suffix, 0);
+        for (size_t tag_index = 1; tag_index < settings.union_width; tag_index++) {
+            source_code += " | " + get_tag_name(file_suffix, tag_index);
+        }
+        source_code += ";\n";
+    }
+    return source_code + "\n";
+}
+
+std::string SyntheticProjectGenerator::generate_overloaded_functions(const std::string& file_suffix) const {
+    std::string source_code;
+    for (size_t tag_index = 0; tag_index < get_tags_count(); tag_index++) {
+        source_code += "func measure_" + file_suffix + "(tag : " + get_tag_name(file_suffix, tag_index) + ") -> Int {\n";
+        source_code += "    return tag.value + " + std::to_string(tag_index) + ";\n";
+        source_code += "}\n\n";
+    }
+    if (settings.generics_depth > 0) {
+        source_code += "func identity_" + file_suffix + "<T>(item : T) -> T {\n";
+        source_code += "    return item;\n";
+        source_code += "}\n\n";
+    }
+    return source_code;
+}
+
+std::string SyntheticProjectGenerator::generate_work_function(
+    size_t package_index, 
+    size_t file_index, 
+    size_t function_index
+) const {
+    std::string file_suffix = get_file_suffix(package_index, file_index);
+    std::string source_code = "func " + get_work_function_name(file_suffix, function_index) + "(seed : Int) -> Int {\n";
+    source_code += "    var x : Int = seed;\n";
+    source_code += "    var tag : " + get_tag_name(file_suffix, function_index % get_tags_count()) + ";\n";
+    source_code += "    tag.value = x;\n";
+    source_code += "    x = x + measure_" + file_suffix + "(tag);\n";
+    if (settings.union_width > 1) {
+        source_code += "    var alternative : " + get_tag_name(file_suffix, function_index % settings.union_width) + ";\n";
+        source_code += "    alternative.value = x;\n";
+        source_code += "    var wide : Wide" + file_suffix + " = alternative;\n";
+        // dispatching over the union yields the union of the return types of the overloads
+        source_code += "    var measured : Int | Bool = measure_" + file_suffix + "(wide);\n";
+        source_code += "    if (measured is Int) { x = x + (measured as Int); }\n";
+        source_code += "    if (wide is " + get_tag_name(file_suffix, 0) + ") { x = x + 1; }\n";
+    }
+    if (settings.generics_depth > 0) {
+        std::string nested_type = get_nested_generic_type(file_suffix, settings.generics_depth);
+        std::string access_path = get_nested_generic_access_path(settings.generics_depth);
+        source_code += "    var nested : " + nested_type + ";\n";
+        source_code += "    nested" + access_path + " = x;\n";
+        source_code += "    var copy : " + nested_type + " = identity_" + file_suffix + "(nested);\n";
+        source_code += "    x = x + copy" + access_path + ";\n";
+    }
+    if (function_index > 0) {
+        source_code += "    x = x + " + get_work_function_name(file_suffix, function_index - 1) + "(x % 100);\n";
+    }
+    for (size_t imported_package : get_imported_packages(package_index, file_index)) {
+        source_code += "    if (seed < 0) { x = x + " + get_package_name(imported_package) + "::entry(seed); }\n";
+    }
+    source_code += generate_nested_statements(settings.statements_nesting, "    ");
+    source_code += "    return x;\n";
+    source_code += "}\n\n";
+    return source_code;
+}
+
+std::string SyntheticProjectGenerator::generate_entry_function(size_t package_index) const {
+    std::string source_code = "func entry(seed : Int) -> Int {\n";
+    source_code += "    var x : Int = seed;\n";
+    for (size_t file_index = 0; file_index < settings.files_per_package; file_index++) {
+        std::string file_suffix = get_file_suffix(package_index, file_index);
+        std::string last_work_function = get_work_function_name(file_suffix, settings.functions_per_file - 1);
+        source_code += "    x = x + " + last_work_function + "(x % 100);\n";
+    }
+    source_code += "    return x;\n";
+    source_code += "}\n";
+    return source_code;
+}
+
+std::string SyntheticProjectGenerator::generate_nested_statements(size_t nesting, const std::string& indentation) const {
+    if (nesting == 0) {
+        return indentation + "x = x + 1;\n";
+    }
+    std::string nested_statements = generate_nested_statements(nesting - 1, indentation + "    ");
+    if (nesting % 2 == 0) {
+        return indentation + "while (x > 1000) {\n" 
+            + indentation + "    x = x / 2;\n" 
+            + nested_statements 
+            + indentation + "}\n";
+    }
+    return indentation + "if (x % 2 == 0) {\n" 
+        + nested_statements 
+        + indentation + "}\n"
+        + indentation + "else {\n"
+        + indentation + "    x = x - 1;\n"
+        + indentation + "}\n";
+}
+
+std::string SyntheticProjectGenerator::get_nested_generic_type(const std::string& file_suffix, size_t depth) const {
+    if (depth == 0) {
+        return "Int";
+    }
+    std::string inner_type = get_nested_generic_type(file_suffix, depth - 1);
+    return (depth % 2 == 1)
+        ? "Box" + file_suffix + "<" + inner_type + ">"
+        : "Pair" + file_suffix + "<Int, " + inner_type + ">";
+}
+
+std::string SyntheticProjectGenerator::get_nested_generic_access_path(size_t depth) const {
+    if (depth == 0) {
+        return "";
+    }
+    std::string member = (depth % 2 == 1) ? ".value" : ".second";
+    return member + get_nested_generic_access_path(depth - 1);
+}
+
+std::vector<size_t> SyntheticProjectGenerator::get_imported_packages(size_t package_index, size_t file_index) const {
+    std::vector<size_t> imported_packages;
+    size_t imports_count = std::min(settings.imports_per_file, package_index);
+    for (size_t import_index = 0; import_index < imports_count; import_index++) {
+        imported_packages.push_back((package_index + file_index + import_index) % package_index);
+    }
+    std::sort(imported_packages.begin(), imported_packages.end());
+    return imported_packages;
+}
+
+size_t SyntheticProjectGenerator::get_tags_count() const {
+    return std::max<size_t>({ settings.overloads_per_name, settings.union_width, 1 });
+}
\ No newline at end of file
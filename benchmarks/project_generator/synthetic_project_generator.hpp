@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// knobs of a synthetic project: every package but the `main` one is made of `files_per_package` files,
+// each file importing up to `imports_per_file` of the previously generated packages.
+struct SyntheticProjectSettings {
+    size_t packages_count = 4;
+    size_t files_per_package = 2;
+    size_t imports_per_file = 2;
+    size_t functions_per_file = 8;
+    size_t overloads_per_name = 4;
+    size_t generics_depth = 3;
+    size_t union_width = 4;
+    size_t statements_nesting = 3;
+};
+
+struct SyntheticSourceFile {
+    std::string file_path;
+    std::string source_code;
+};
+
+class SyntheticProjectGenerator {
+
+    public:
+        SyntheticProjectGenerator(const SyntheticProjectSettings& settings);
+
+        [[nodiscard]] std::vector<SyntheticSourceFile> generate_project() const;
+        [[nodiscard]] std::vector<std::string> write_project(const std::string& output_directory) const;
+
+    protected:
+        [[nodiscard]] SyntheticSourceFile generate_package_file(size_t package_index, size_t file_index) const;
+        [[nodiscard]] SyntheticSourceFile generate_main_file() const;
+
+        [[nodiscard]] std::string generate_type_definitions(const std::string& file_suffix) const;
+        [[nodiscard]] std::string generate_overloaded_functions(const std::string& file_suffix) const;
+        [[nodiscard]] std::string generate_work_function(size_t package_index, size_t file_index, size_t function_index) const;
+        [[nodiscard]] std::string generate_entry_function(size_t package_index) const;
+        [[nodiscard]] std::string generate_nested_statements(size_t nesting, const std::string& indentation) const;
+
+        [[nodiscard]] std::string get_nested_generic_type(const std::string& file_suffix, size_t depth) const;
+        [[nodiscard]] std::string get_nested_generic_access_path(size_t depth) const;
+        [[nodiscard]] std::vector<size_t> get_imported_packages(size_t package_index, size_t file_index) const;
+        [[nodiscard]] size_t get_tags_count() const;
+
+    private:
+        SyntheticProjectSettings settings;
+};
\ No newline at end of file
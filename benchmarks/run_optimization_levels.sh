@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+
+# Compiles every program of the benchmark corpus once per optimization level,
+# links it with the system C compiler and reports the best wall-clock runtime.
+# usage: benchmarks/run_optimization_levels.sh [basalt-executable] [repetitions]
+
+set -euo pipefail
+
+BENCHMARKS_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+ROOT_DIR="$(dirname "$BENCHMARKS_DIR")"
+BASALT="${1:-$ROOT_DIR/out/bin/basalt}"
+REPETITIONS="${2:-5}"
+CC="${CC:-cc}"
+LEVELS=(-O0 -O1 -O2 -O3 -Os)
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+printf "%-24s" "program"
+for level in "${LEVELS[@]}"; do
+    printf "%12s" "$level"
+done
+printf "\n"
+
+for program in "$BENCHMARKS_DIR"/corpus/*.bt; do
+    name="$(basename "$program" .bt)"
+    printf "%-24s" "$name"
+    for level in "${LEVELS[@]}"; do
+        object_file="$WORK_DIR/$name$level.o"
+        executable="$WORK_DIR/$name$level"
+        "$BASALT" compile "$level" -i "$program" "$ROOT_DIR"/pkgs/*/*.bt -o "$object_file" > /dev/null
+        "$CC" "$object_file" -o "$executable"
+        best=""
+        for ((repetition = 0; repetition < REPETITIONS; repetition++)); do
+            start=$(date +%s%N)
+            "$executable" > /dev/null
+            elapsed=$(( ($(date +%s%N) - start) / 1000000 ))
+            if [[ -z "$best" || "$elapsed" -lt "$best" ]]; then
+                best="$elapsed"
+            fi
+        done
+        printf "%10sms" "$best"
+    done
+    printf "\n"
+done
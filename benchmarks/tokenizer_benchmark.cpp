@@ -0,0 +1,112 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <filesystem>
+#include <functional>
+
+#include "frontend/tokenizer.hpp"
+#include "frontend/mapped_tokenizer.hpp"
+
+// usage: basalt_tokenizer_benchmark [repetitions] [copies] files...
+// every input file is concatenated `copies` times into a temporary source file,
+// which is then tokenized `repetitions` times by every tokenizer variant.
+
+static size_t allocations_counter = 0;
+static size_t allocated_bytes_counter = 0;
+
+void* operator new(size_t size) {
+    allocations_counter++;
+    allocated_bytes_counter += size;
+    if (void* address = std::malloc(size == 0 ? 1 : size)) {
+        return address;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* address) noexcept {
+    std::free(address);
+}
+
+void operator delete(void* address, size_t) noexcept {
+    std::free(address);
+}
+
+struct BenchmarkOutcome {
+    double best_seconds = 0;
+    size_t tokens = 0;
+    size_t allocations = 0;
+    size_t allocated_bytes = 0;
+};
+
+static BenchmarkOutcome run_benchmark(size_t repetitions, const std::function<size_t()>& tokenize) {
+    BenchmarkOutcome outcome;
+    for (size_t repetition = 0; repetition < repetitions; repetition++) {
+        size_t allocations_before = allocations_counter;
+        size_t allocated_bytes_before = allocated_bytes_counter;
+        auto start = std::chrono::steady_clock::now();
+        outcome.tokens = tokenize();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (repetition == 0 || elapsed.count() < outcome.best_seconds) {
+            outcome.best_seconds = elapsed.count();
+        }
+        outcome.allocations = allocations_counter - allocations_before;
+        outcome.allocated_bytes = allocated_bytes_counter - allocated_bytes_before;
+    }
+    return outcome;
+}
+
+static void print_benchmark_outcome(const std::string& name, const BenchmarkOutcome& outcome, size_t input_size) {
+    double megabytes = static_cast<double>(input_size) / (1024.0 * 1024.0);
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(2)
+        << std::setw(10) << outcome.best_seconds * 1000.0 << " ms"
+        << std::setw(10) << megabytes / outcome.best_seconds << " MB/s"
+        << std::setw(12) << static_cast<double>(outcome.tokens) / outcome.best_seconds / 1e6 << " Mtok/s"
+        << std::setw(12) << outcome.allocations << " allocs"
+        << std::setw(14) << outcome.allocated_bytes << " bytes" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "usage: " << argv[0] << " [repetitions] [copies] files..." << std::endl;
+        return EXIT_FAILURE;
+    }
+    size_t repetitions = std::stoul(argv[1]);
+    size_t copies = std::stoul(argv[2]);
+    std::ostringstream concatenated_input;
+    for (int i = 3; i < argc; i++) {
+        std::ifstream input_file(argv[i]);
+        concatenated_input << input_file.rdbuf() << '\n';
+    }
+    std::filesystem::path benchmark_input = std::filesystem::temp_directory_path() / "basalt_tokenizer_benchmark.bt";
+    std::ofstream benchmark_input_file(benchmark_input);
+    for (size_t copy = 0; copy < copies; copy++) {
+        benchmark_input_file << concatenated_input.str();
+    }
+    benchmark_input_file.close();
+    size_t input_size = std::filesystem::file_size(benchmark_input);
+    std::cout << "input: " << input_size << " bytes, best of " << repetitions << " runs" << std::endl;
+
+    print_benchmark_outcome("Tokenizer::tokenize", run_benchmark(repetitions, [&](){
+        Tokenizer tokenizer(benchmark_input.string());
+        return tokenizer.tokenize().tokens.size();
+    }), input_size);
+
+    print_benchmark_outcome("MappedTokenizer::tokenize", run_benchmark(repetitions, [&](){
+        SourceFilesRegistry source_files_registry;
+        MappedTokenizer tokenizer(source_files_registry, source_files_registry.map_source_file(benchmark_input.string()));
+        return tokenizer.tokenize().tokens.size();
+    }), input_size);
+
+    print_benchmark_outcome("MappedTokenizer::tokenize_as_views", run_benchmark(repetitions, [&](){
+        SourceFilesRegistry source_files_registry;
+        MappedTokenizer tokenizer(source_files_registry, source_files_registry.map_source_file(benchmark_input.string()));
+        return tokenizer.tokenize_as_views().size();
+    }), input_size);
+
+    std::filesystem::remove(benchmark_input);
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -10,8 +10,10 @@
 #include "core/program_representation.hpp"
 #include "core/scope_context.hpp"
 #include "backend/type_definitions_llvm_translator.hpp"
+#include "backend/literals_pool.hpp"
 #include "language/definitions.hpp"
 #include "backend/translation_aware_scope_context.hpp"
+#include "backend/frame_slots_allocator.hpp"
 #include "backend/expressions_and_statements_llvm_translator.hpp"
 
 #include <llvm/IR/IRBuilder.h>
@@ -24,6 +26,7 @@ class CallableCodeBlocksLLVMTranslator {
         CallableCodeBlocksLLVMTranslator(
             ProgramRepresentation& program_representation, 
             TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator,
+            LiteralsPool& literals_pool,
             llvm::LLVMContext& llvm_context,
             llvm::Module& llvm_module
         );
@@ -42,7 +45,16 @@ class CallableCodeBlocksLLVMTranslator {
             llvm::Function* llvm_function
         );
 
+        [[nodiscard]] bool is_argument_passed_by_address(
+            const CallableCodeBlock& callable_code_block,
+            const TypeSignature& arg_type
+        );
+
     protected:
+        [[nodiscard]] llvm::GlobalValue::LinkageTypes get_linkage_policy(
+            const CallableCodeBlock& callable_code_block
+        );
+
         [[nodiscard]] llvm::Function* translate_local_function_definition_to_llvm(
             const FunctionDefinition::Ref& function_definition, 
             llvm::Function* llvm_function
@@ -55,6 +67,7 @@ class CallableCodeBlocksLLVMTranslator {
 
         [[nodiscard]] ExpressionsAndStatementsLLVMTranslator get_function_body_translator(
             TranslationAwareScopeContext scope_context,
+            FrameSlotsAllocator& frame_slots_allocator,
             std::optional<TypeSignature> expected_return_type,
             llvm::Module& llvm_module,
             llvm::Function* llvm_function,
@@ -70,26 +83,36 @@ class CallableCodeBlocksLLVMTranslator {
             const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor, 
             const CommonFeatureAdoptionPlan& cfa_plan,
             llvm::Function* llvm_function,
-            llvm::BasicBlock* block
+            llvm::BasicBlock* block,
+            FrameSlotsAllocator& frame_slots_allocator
         );
 
         void translate_cfa_recursive_adoption_to_llvm(
             const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor, 
             const RecursiveAdoptionPlan& recursive_plan,
             llvm::Function* llvm_function,
-            llvm::BasicBlock* block
+            llvm::BasicBlock* block,
+            FrameSlotsAllocator& frame_slots_allocator
         );
 
         void translate_cfa_direct_adoption_to_llvm(
             const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor,
             const FunctionDefinition::Ref& selected_concrete_function,
             llvm::Function* llvm_function,
-            llvm::BasicBlock* block
+            llvm::BasicBlock* block,
+            FrameSlotsAllocator& frame_slots_allocator
+        );
+
+        [[nodiscard]] TranslatedExpression translate_cfa_argument_to_llvm(
+            const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor,
+            llvm::Function* llvm_function,
+            size_t arg_index
         );
 
     private:
         ProgramRepresentation& program_representation;
         TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator;
+        LiteralsPool& literals_pool;
         std::map<std::string, llvm::Function*> llvm_functions;
         llvm::LLVMContext& llvm_context;
         llvm::Module& llvm_module;
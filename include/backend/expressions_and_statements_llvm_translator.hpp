@@ -12,7 +12,9 @@
 #include "language/definitions.hpp"
 #include "core/program_representation.hpp"
 #include "backend/type_definitions_llvm_translator.hpp"
+#include "backend/literals_pool.hpp"
 #include "backend/translation_aware_scope_context.hpp"
+#include "backend/frame_slots_allocator.hpp"
 #include "backend/translated_expression.hpp"
 
 
@@ -26,7 +28,9 @@ class ExpressionsAndStatementsLLVMTranslator {
         ExpressionsAndStatementsLLVMTranslator(
             ProgramRepresentation& program_representation, 
             TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator,
+            LiteralsPool& literals_pool,
             CallableCodeBlocksLLVMTranslator& callable_codeblocks_llvm_translator,
+            FrameSlotsAllocator& frame_slots_allocator,
             TranslationAwareScopeContext scope_context,
             std::optional<TypeSignature> expected_return_type,
             llvm::LLVMContext& context,
@@ -49,76 +53,85 @@ class ExpressionsAndStatementsLLVMTranslator {
         llvm::BasicBlock* translate_void_function_call_to_llvm(llvm::BasicBlock* block, const FunctionCall& function_call);
         llvm::BasicBlock* translate_assignment_to_llvm(llvm::BasicBlock* block, const Expression& target, const Expression& source);
 
-        [[nodiscard]] TranslatedExpression translate_expression_to_llvm(llvm::BasicBlock* block, const Expression& expression);
-        [[nodiscard]] TranslatedExpression translate_expr_function_call_to_llvm(llvm::BasicBlock* block, const FunctionCall& expr);
-        [[nodiscard]] TranslatedExpression translate_array_literal_to_llvm(llvm::BasicBlock* block, const ArrayLiteral& expr);
-        [[nodiscard]] TranslatedExpression translate_binary_operator_to_llvm(llvm::BasicBlock* block, const BinaryOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_boolean_literal_to_llvm(llvm::BasicBlock* block, const BoolLiteral& expr);
-        [[nodiscard]] TranslatedExpression translate_character_literal_to_llvm(llvm::BasicBlock* block, const CharLiteral& expr);
-        [[nodiscard]] TranslatedExpression translate_floating_literal_to_llvm(llvm::BasicBlock* block, const FloatLiteral& expr);
-        [[nodiscard]] TranslatedExpression translate_identifier_to_llvm(llvm::BasicBlock* block, const Identifier& expr);
-        [[nodiscard]] TranslatedExpression translate_integer_literal_to_llvm(llvm::BasicBlock* block, const IntLiteral& expr);
-        [[nodiscard]] TranslatedExpression translate_string_literal_to_llvm(llvm::BasicBlock* block, const StringLiteral& expr);
-        [[nodiscard]] TranslatedExpression translate_type_operator_to_llvm(llvm::BasicBlock* block, const TypeOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_unary_operator_to_llvm(llvm::BasicBlock* block, const UnaryOperator& expr);
-
-        [[nodiscard]] TranslatedExpression translate_is_operator_to_llvm(llvm::BasicBlock* block, const TypeOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_as_operator_to_llvm(llvm::BasicBlock* block, const TypeOperator& expr);
-
-        [[nodiscard]] TranslatedExpression translate_plus_binary_operator_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op); 
-        [[nodiscard]] TranslatedExpression translate_minus_binary_operator_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);
-        [[nodiscard]] TranslatedExpression translate_mul_binary_operator_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);  
-        [[nodiscard]] TranslatedExpression translate_div_binary_operator_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);  
-        [[nodiscard]] TranslatedExpression translate_mod_binary_operator_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);  
-        [[nodiscard]] TranslatedExpression translate_LT_then_comparison_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);   
-        [[nodiscard]] TranslatedExpression translate_GT_comparison_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);        
-        [[nodiscard]] TranslatedExpression translate_LE_comparison_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);        
-        [[nodiscard]] TranslatedExpression translate_GE_comparison_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);        
-        [[nodiscard]] TranslatedExpression translate_EQ_comparison_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);        
-        [[nodiscard]] TranslatedExpression translate_NE_comparison_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);        
-        [[nodiscard]] TranslatedExpression translate_boolean_and_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);          
-        [[nodiscard]] TranslatedExpression translate_boolean_or_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);           
-        [[nodiscard]] TranslatedExpression translate_boolean_xor_to_llvm(llvm::BasicBlock* block, const BinaryOperator& binary_op);  
-
-        [[nodiscard]] TranslatedExpression translate_boolean_not_to_llvm(llvm::BasicBlock* block, const UnaryOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_minus_sign_to_llvm(llvm::BasicBlock* block, const UnaryOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_plus_sign_to_llvm(llvm::BasicBlock* block, const UnaryOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_ptr_dereference_to_llvm(llvm::BasicBlock* block, const UnaryOperator& expr);
-        [[nodiscard]] TranslatedExpression translate_addressof_to_llvm(llvm::BasicBlock* block, const UnaryOperator& expr);
-
-        [[nodiscard]] TranslatedExpression translate_square_bracket_access_to_llvm(llvm::BasicBlock* block, const SquareBracketsAccess& expr);
-        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_array_to_llvm(llvm::BasicBlock* block, const SquareBracketsAccess& expr);
-        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_slice_to_llvm(llvm::BasicBlock* block, const SquareBracketsAccess& expr);
-        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_string_to_llvm(llvm::BasicBlock* block, const SquareBracketsAccess& expr);
-        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_raw_string_to_llvm(llvm::BasicBlock* block, const SquareBracketsAccess& expr);
+        [[nodiscard]] TranslatedExpression translate_expression_to_llvm(llvm::BasicBlock*& block, const Expression& expression);
+        [[nodiscard]] TranslatedExpression translate_expr_function_call_to_llvm(llvm::BasicBlock*& block, const FunctionCall& expr);
+        [[nodiscard]] TranslatedExpression translate_array_literal_to_llvm(llvm::BasicBlock*& block, const ArrayLiteral& expr);
+        [[nodiscard]] TranslatedExpression translate_binary_operator_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_boolean_literal_to_llvm(llvm::BasicBlock*& block, const BoolLiteral& expr);
+        [[nodiscard]] TranslatedExpression translate_character_literal_to_llvm(llvm::BasicBlock*& block, const CharLiteral& expr);
+        [[nodiscard]] TranslatedExpression translate_floating_literal_to_llvm(llvm::BasicBlock*& block, const FloatLiteral& expr);
+        [[nodiscard]] TranslatedExpression translate_identifier_to_llvm(llvm::BasicBlock*& block, const Identifier& expr);
+        [[nodiscard]] TranslatedExpression translate_integer_literal_to_llvm(llvm::BasicBlock*& block, const IntLiteral& expr);
+        [[nodiscard]] TranslatedExpression translate_string_literal_to_llvm(llvm::BasicBlock*& block, const StringLiteral& expr);
+        [[nodiscard]] TranslatedExpression translate_type_operator_to_llvm(llvm::BasicBlock*& block, const TypeOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_unary_operator_to_llvm(llvm::BasicBlock*& block, const UnaryOperator& expr);
+
+        [[nodiscard]] TranslatedExpression translate_is_operator_to_llvm(llvm::BasicBlock*& block, const TypeOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_as_operator_to_llvm(llvm::BasicBlock*& block, const TypeOperator& expr);
+
+        [[nodiscard]] TranslatedExpression translate_plus_binary_operator_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op); 
+        [[nodiscard]] TranslatedExpression translate_minus_binary_operator_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);
+        [[nodiscard]] TranslatedExpression translate_mul_binary_operator_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);  
+        [[nodiscard]] TranslatedExpression translate_div_binary_operator_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);  
+        [[nodiscard]] TranslatedExpression translate_mod_binary_operator_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);  
+        [[nodiscard]] TranslatedExpression translate_LT_then_comparison_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);   
+        [[nodiscard]] TranslatedExpression translate_GT_comparison_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);        
+        [[nodiscard]] TranslatedExpression translate_LE_comparison_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);        
+        [[nodiscard]] TranslatedExpression translate_GE_comparison_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);        
+        [[nodiscard]] TranslatedExpression translate_EQ_comparison_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);        
+        [[nodiscard]] TranslatedExpression translate_NE_comparison_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);        
+        [[nodiscard]] TranslatedExpression translate_boolean_and_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);          
+        [[nodiscard]] TranslatedExpression translate_boolean_or_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);           
+        [[nodiscard]] TranslatedExpression translate_boolean_xor_to_llvm(llvm::BasicBlock*& block, const BinaryOperator& binary_op);  
+
+        [[nodiscard]] TranslatedExpression translate_boolean_not_to_llvm(llvm::BasicBlock*& block, const UnaryOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_minus_sign_to_llvm(llvm::BasicBlock*& block, const UnaryOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_plus_sign_to_llvm(llvm::BasicBlock*& block, const UnaryOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_ptr_dereference_to_llvm(llvm::BasicBlock*& block, const UnaryOperator& expr);
+        [[nodiscard]] TranslatedExpression translate_addressof_to_llvm(llvm::BasicBlock*& block, const UnaryOperator& expr);
+
+        [[nodiscard]] TranslatedExpression translate_square_bracket_access_to_llvm(llvm::BasicBlock*& block, const SquareBracketsAccess& expr);
+        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_array_to_llvm(llvm::BasicBlock*& block, const SquareBracketsAccess& expr);
+        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_slice_to_llvm(llvm::BasicBlock*& block, const SquareBracketsAccess& expr);
+        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_string_to_llvm(llvm::BasicBlock*& block, const SquareBracketsAccess& expr);
+        [[nodiscard]] TranslatedExpression translate_square_bracket_access_from_raw_string_to_llvm(llvm::BasicBlock*& block, const SquareBracketsAccess& expr);
         
-        [[nodiscard]] TranslatedExpression translate_string_or_slice_length_to_llvm(llvm::BasicBlock* block, const Expression& expr);
+        [[nodiscard]] TranslatedExpression translate_string_or_slice_length_to_llvm(llvm::BasicBlock*& block, const Expression& expr);
 
         [[nodiscard]] TranslatedExpression translate_dot_member_access_to_llvm(
-            llvm::BasicBlock* block, 
+            llvm::BasicBlock*& block, 
             const DotMemberAccess& expr
         );
         
         [[nodiscard]] TranslatedExpression translate_dot_member_access_on_custom_type_to_llvm(
-            llvm::BasicBlock* block, 
+            llvm::BasicBlock*& block, 
             const DotMemberAccess& expr
         );
 
         [[nodiscard]] TranslatedExpression translate_dot_member_access_on_primitive_type_to_llvm(
-            llvm::BasicBlock* block,
+            llvm::BasicBlock*& block,
             const Expression& accessed_expression,
             const PrimitiveType primitive_type,
             const std::string& member_name
         );
 
         [[nodiscard]] TranslatedExpression translate_dot_member_access_on_slice_type_to_llvm(
-            llvm::BasicBlock* block,
+            llvm::BasicBlock*& block,
             const Expression& accessed_expression,
             const SliceType& slice_type,
             const std::string& member_name
         );
 
     protected:        
+        [[nodiscard]] TranslatedExpression translate_short_circuit_boolean_operator_to_llvm(
+            llvm::BasicBlock*& block, 
+            const BinaryOperator& binary_op,
+            bool short_circuit_outcome
+        );
+
+        [[nodiscard]] llvm::Constant* translate_constant_array_literal_to_llvm(const ArrayLiteral& expr);
+        [[nodiscard]] llvm::Constant* translate_expression_to_llvm_constant(const Expression& expr);
+
         [[nodiscard]] ExpressionsAndStatementsLLVMTranslator create_translator_for_nested_conditional();
 
         [[nodiscard]] ExpressionsAndStatementsLLVMTranslator create_translator_for_nested_loop(
@@ -129,7 +142,9 @@ class ExpressionsAndStatementsLLVMTranslator {
     private:
         ProgramRepresentation& program_representation;
         TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator;
+        LiteralsPool& literals_pool;
         CallableCodeBlocksLLVMTranslator& callable_codeblocks_llvm_translator;
+        FrameSlotsAllocator& frame_slots_allocator;
         TranslationAwareScopeContext scope_context;
         std::optional<TypeSignature> expected_return_type;
 
@@ -8,10 +8,14 @@
 #include <vector>
 #include <string>
 #include <system_error>
+#include <chrono>
+#include <memory>
 
 #include "core/program_representation.hpp"
 #include "preprocessing/preprocessor.hpp"
+#include "cli/optimization_levels.hpp"
 #include "backend/type_definitions_llvm_translator.hpp"
+#include "backend/literals_pool.hpp"
 #include "backend/callable_codeblocks_llvm_translator.hpp"
 
 #include <llvm/IR/IRBuilder.h>
@@ -19,6 +23,7 @@
 #include <llvm/IR/Verifier.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Passes/PassBuilder.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/TargetRegistry.h>
 #include <llvm/Target/TargetMachine.h>
@@ -26,25 +31,51 @@
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/MC/MCSubtargetInfo.h>
 
 class Finalizer {
 
     public:
-        Finalizer(ProgramRepresentation& program_representation, std::optional<std::string> target_triple_opt);
-        Finalizer(ProgramRepresentation& program_representation, const std::string& target_triple);
+        Finalizer(
+            ProgramRepresentation& program_representation, 
+            std::optional<std::string> target_triple_opt, 
+            std::optional<std::string> target_cpu_opt = std::nullopt,
+            std::optional<std::string> target_features_opt = std::nullopt,
+            OptimizationLevel optimization_level = OptimizationLevel::O0
+        );
+
+        Finalizer(
+            ProgramRepresentation& program_representation, 
+            const std::string& target_triple, 
+            const std::string& target_cpu = "",
+            const std::string& target_features = "",
+            OptimizationLevel optimization_level = OptimizationLevel::O0
+        );
+
         Finalizer(ProgramRepresentation& program_representation);
 
         void emit_object_file(const std::string& output_file);
         void emit_assembly_file(const std::string& output_file_name);
         void emit_llvm_ir(const std::string& output_file);
         void generate_llvm_ir();
+        void optimize_llvm_ir();
+        [[nodiscard]] int execute_llvm_ir_just_in_time(std::chrono::steady_clock::time_point startup_instant);
+
+    protected:
+        void apply_target_attributes_to_llvm_functions();
+        [[nodiscard]] llvm::PassBuilder::OptimizationLevel get_llvm_optimization_level() const;
+        [[nodiscard]] llvm::CodeGenOpt::Level get_llvm_codegen_optimization_level() const;
 
     private:
         ProgramRepresentation& program_representation;
         std::string target_triple;
-        llvm::LLVMContext llvm_context;
-        llvm::Module llvm_module;
+        std::string target_cpu;
+        std::string target_features;
+        OptimizationLevel optimization_level;
+        std::unique_ptr<llvm::LLVMContext> llvm_context;
+        std::unique_ptr<llvm::Module> llvm_module;
         llvm::TargetMachine* llvm_target_machine;
         TypeDefinitionsLLVMTranslator type_definitions_llvm_translator;
+        LiteralsPool literals_pool;
         CallableCodeBlocksLLVMTranslator callable_codeblocks_llvm_translator;
 };
\ No newline at end of file
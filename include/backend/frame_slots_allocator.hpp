@@ -0,0 +1,29 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+class FrameSlotsAllocator {
+
+    public:
+        FrameSlotsAllocator(llvm::BasicBlock* entry_block);
+
+        [[nodiscard]] llvm::AllocaInst* allocate_frame_slot(llvm::Type* slot_type);
+
+        void open_lifetime_scope();
+        void close_lifetime_scope();
+
+    private:
+        llvm::BasicBlock* entry_block;
+        std::map<llvm::Type*, std::vector<llvm::AllocaInst*>> free_frame_slots;
+        std::vector<std::vector<llvm::AllocaInst*>> lifetime_scopes;
+};
\ No newline at end of file
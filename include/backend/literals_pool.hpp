@@ -0,0 +1,28 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+class LiteralsPool {
+
+    public:
+        LiteralsPool(llvm::LLVMContext& llvm_context, llvm::Module& llvm_module);
+
+        [[nodiscard]] llvm::GlobalVariable* intern_constant_array(llvm::Constant* constant_array);
+        [[nodiscard]] llvm::GlobalVariable* intern_string_literal(const std::string& text, llvm::StructType* string_type);
+
+    private:
+        llvm::LLVMContext& llvm_context;
+        llvm::Module& llvm_module;
+        std::unordered_map<llvm::Constant*, llvm::GlobalVariable*> constant_arrays;
+        std::unordered_map<std::string, llvm::GlobalVariable*> string_literals;
+};
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "backend/translated_expression.hpp"
+#include "backend/frame_slots_allocator.hpp"
 
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LLVMContext.h>
@@ -14,16 +15,81 @@
 
 inline llvm::Value* get_llvm_address(
     llvm::IRBuilder<>& builder,
+    FrameSlotsAllocator& frame_slots_allocator,
     const TranslatedExpression& expr
 ) {
     llvm::Value* address = expr.address;
     if (address == nullptr) {
-        address = builder.CreateAlloca(expr.value->getType());
+        address = frame_slots_allocator.allocate_frame_slot(expr.value->getType());
         builder.CreateStore(expr.value, address);
     }
     return address;
 }
 
+inline llvm::Value* get_llvm_value(
+    llvm::IRBuilder<>& builder,
+    const TranslatedExpression& expr
+) {
+    return (expr.value != nullptr)
+        ? expr.value
+        : builder.CreateLoad(expr.address);
+}
+
+inline TranslatedExpression create_load_unless_aggregate(
+    llvm::IRBuilder<>& builder,
+    llvm::Value* address,
+    bool is_addressable = true
+) {
+    if (address->getType()->getPointerElementType()->isAggregateType()) {
+        return TranslatedExpression(nullptr, address);
+    }
+    llvm::Value* value = builder.CreateLoad(address);
+    return (is_addressable)
+        ? TranslatedExpression(value, address)
+        : TranslatedExpression(value);
+}
+
+inline void create_store_or_aggregate_copy(
+    llvm::IRBuilder<>& builder,
+    const TranslatedExpression& source,
+    llvm::Value* dest_address,
+    bool source_may_overlap_dest
+) {
+    if (source.value != nullptr) {
+        builder.CreateStore(source.value, dest_address);
+        return;
+    }
+    if (source.address == dest_address) {
+        return;
+    }
+    const llvm::DataLayout& data_layout = builder.GetInsertBlock()->getModule()->getDataLayout();
+    llvm::Type* source_type = source.address->getType()->getPointerElementType();
+    llvm::Type* dest_type = dest_address->getType()->getPointerElementType();
+    llvm::Align source_align = data_layout.getABITypeAlign(source_type);
+    llvm::Align dest_align = data_layout.getABITypeAlign(dest_type);
+    uint64_t copy_size = data_layout.getTypeAllocSize(source_type);
+    if (source_may_overlap_dest) {
+        builder.CreateMemMove(dest_address, dest_align, source.address, source_align, copy_size);
+    }
+    else {
+        builder.CreateMemCpy(dest_address, dest_align, source.address, source_align, copy_size);
+    }
+}
+
+inline llvm::Value* create_aggregate_snapshot(
+    llvm::IRBuilder<>& builder,
+    FrameSlotsAllocator& frame_slots_allocator,
+    const TranslatedExpression& expr
+) {
+    if (expr.address == nullptr) {
+        return get_llvm_address(builder, frame_slots_allocator, expr);
+    }
+    llvm::Type* snapshot_type = expr.address->getType()->getPointerElementType();
+    llvm::Value* snapshot_address = frame_slots_allocator.allocate_frame_slot(snapshot_type);
+    create_store_or_aggregate_copy(builder, expr, snapshot_address, false);
+    return snapshot_address;
+}
+
 inline llvm::Value* create_array_gep(
     llvm::IRBuilder<>& builder,
     llvm::Value* proper_array_address_not_ptr,
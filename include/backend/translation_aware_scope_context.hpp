@@ -15,7 +15,7 @@
 struct TranslationAwareScopeContext {
     TranslationAwareScopeContext(
         ScopeContext raw_scope_context,
-        std::shared_ptr<std::map<std::string, llvm::AllocaInst*>> local_variables
+        std::shared_ptr<std::vector<llvm::Value*>> local_variables
     ) 
         : raw_scope_context(raw_scope_context) 
         , local_variables(local_variables)
@@ -30,25 +30,29 @@ struct TranslationAwareScopeContext {
 
     void store_local_variable(const VariableDeclaration& variable_declaration, llvm::AllocaInst* alloca_inst) {
         raw_scope_context.store_local_variable(variable_declaration);
-        std::string llvm_identifier_name = raw_scope_context.resolve_object_unique_id(variable_declaration.identifier_name);
-        local_variables->insert({llvm_identifier_name, alloca_inst});
+        bind_slot_to_allocation(raw_scope_context.resolve_object_slot_id(variable_declaration.identifier_name), alloca_inst);
     }
 
-    void store_local_constant(const ConstDeclaration& const_declaration, llvm::AllocaInst* alloca_inst) {
+    void store_local_constant(const ConstDeclaration& const_declaration, llvm::Value* address) {
         raw_scope_context.store_local_constant(const_declaration);
-        std::string llvm_identifier_name = raw_scope_context.resolve_object_unique_id(const_declaration.identifier_name);
-        local_variables->insert({llvm_identifier_name, nullptr});
+        bind_slot_to_allocation(raw_scope_context.resolve_object_slot_id(const_declaration.identifier_name), address);
     }
 
-    [[nodiscard]] llvm::AllocaInst* resolve_object_allocation(const std::string& identifier) {
-        std::string unique_id = raw_scope_context.resolve_object_unique_id(identifier);
-        auto search_outcome = local_variables->find(unique_id);
-        bool search_success = search_outcome != local_variables->end();
+    [[nodiscard]] llvm::Value* resolve_object_allocation(const std::string& identifier) {
+        ScopeSymbolTable::SlotId slot_id = raw_scope_context.resolve_object_slot_id(identifier);
+        bool search_success = slot_id < local_variables->size() && (*local_variables)[slot_id] != nullptr;
         assert_local_variable_was_found_in_translation_aware_scope_context(search_success);
-        return search_outcome->second;
+        return (*local_variables)[slot_id];
+    }
+
+    void bind_slot_to_allocation(ScopeSymbolTable::SlotId slot_id, llvm::Value* address) {
+        if (slot_id >= local_variables->size()) {
+            local_variables->resize(slot_id + 1, nullptr);
+        }
+        (*local_variables)[slot_id] = address;
     }
 
     ScopeContext raw_scope_context;
-    std::shared_ptr<std::map<std::string, llvm::AllocaInst*>> local_variables = 
-        std::make_shared<std::map<std::string, llvm::AllocaInst*>>();
+    std::shared_ptr<std::vector<llvm::Value*>> local_variables = 
+        std::make_shared<std::vector<llvm::Value*>>();
 };
\ No newline at end of file
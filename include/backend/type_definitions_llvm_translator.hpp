@@ -46,13 +46,19 @@ class TypeDefinitionsLLVMTranslator {
 
         [[nodiscard]] std::vector<llvm::Type*> translate_all_types_to_llvm_types(const std::vector<TypeSignature>& types);
 
-        [[nodiscard]] llvm::GlobalVariable* fetch_type_info(const TypeSignature& type_signature);
-        [[nodiscard]] std::vector<llvm::GlobalVariable*> fetch_all_type_infos_for_non_union_compatible_types(const TypeSignature& type_signature);
+        [[nodiscard]] llvm::IntegerType* get_type_tag_llvm_type();
+        [[nodiscard]] llvm::ConstantInt* fetch_type_tag(const TypeSignature& type_signature);
+        [[nodiscard]] std::vector<llvm::ConstantInt*> fetch_all_type_tags_for_non_union_compatible_types(const TypeSignature& type_signature);
+        [[nodiscard]] std::vector<llvm::ConstantInt*> fetch_all_type_tags_matching_type(const TypeSignature& type_signature);
 
     protected:
         [[nodiscard]] llvm::Type* translate_union_to_llvm_type(
             const std::vector<TypeSignature>& alternatives,
-            const std::string& fully_qualified_name
+            TypeId union_type_id
+        );
+
+        void assign_contiguous_type_tags_to_union_alternatives(
+            const std::vector<TypeSignature>& alternatives
         );
 
     private:
@@ -60,7 +66,8 @@ class TypeDefinitionsLLVMTranslator {
         llvm::LLVMContext& context;
         llvm::Module& llvm_module;
 
-        std::unordered_map<std::string, llvm::Type*> llvm_type_definitions;
-        std::unordered_map<std::string, llvm::GlobalVariable*> llvm_exact_type_infos;
-        std::unordered_map<std::string, std::vector<llvm::GlobalVariable*>> llvm_compatible_type_infos;
+        std::unordered_map<TypeId, llvm::Type*> llvm_type_definitions;
+        std::unordered_map<TypeId, llvm::Type*> llvm_custom_types;
+        std::unordered_map<TypeId, llvm::ConstantInt*> llvm_type_tags;
+        std::unordered_map<TypeId, std::vector<llvm::ConstantInt*>> llvm_compatible_type_tags;
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "core/program_representation.hpp"
 #include "backend/translated_expression.hpp"
 #include "backend/type_definitions_llvm_translator.hpp"
+#include "backend/frame_slots_allocator.hpp"
 
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LLVMContext.h>
@@ -19,7 +20,13 @@ class TypeManipulationsLLVMTranslator {
     public:
         TypeManipulationsLLVMTranslator(
             ProgramRepresentation& program_representation, 
-            TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator
+            TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator,
+            FrameSlotsAllocator& frame_slots_allocator
+        );
+
+        [[nodiscard]] llvm::Value* extract_type_tag_from_union_in_llvm(
+            llvm::BasicBlock* block,
+            TranslatedExpression union_expression
         );
 
         [[nodiscard]] TranslatedExpression test_concrete_type_of_union_in_llvm(
@@ -48,6 +55,12 @@ class TypeManipulationsLLVMTranslator {
         );
 
     protected:
+        [[nodiscard]] TranslatedExpression test_type_tag_membership_in_llvm(
+            llvm::BasicBlock* block,
+            llvm::Value* type_tag,
+            const std::vector<llvm::ConstantInt*>& sorted_expected_type_tags
+        );
+
         enum class CastStrategy {
             noop,
             union_to_union,
@@ -60,6 +73,7 @@ class TypeManipulationsLLVMTranslator {
             slice_to_raw_string,
             string_to_raw_string,
             array_to_array,
+            integer_to_integer,
         };
 
         [[nodiscard]] CastStrategy compute_cast_strategy(
@@ -97,6 +111,12 @@ class TypeManipulationsLLVMTranslator {
             TranslatedExpression string_expression
         );
 
+        [[nodiscard]] TranslatedExpression cast_integer_to_integer_of_another_width_in_llvm(
+            llvm::BasicBlock* block,
+            TranslatedExpression integer_expression,
+            const TypeSignature& dest_type
+        );
+
         [[nodiscard]] TranslatedExpression cast_array_to_array_of_another_type_in_llvm(
             llvm::BasicBlock* block,
             TranslatedExpression array_expression,
@@ -107,4 +127,5 @@ class TypeManipulationsLLVMTranslator {
     private:
         ProgramRepresentation& program_representation;
         TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator;
+        FrameSlotsAllocator& frame_slots_allocator;
 };
\ No newline at end of file
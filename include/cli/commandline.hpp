@@ -10,6 +10,7 @@
 #include <optional>
 
 #include "cli/file_extensions.hpp"
+#include "cli/optimization_levels.hpp"
 
 class CommandLineController {
 
@@ -37,6 +38,13 @@ class CommandLineController {
         void validate_output_files();
         void validate_input_files();
         void parse_target_triple();
+        void parse_optimization_level();
+        void parse_target_cpu();
+        void parse_target_features();
+        void parse_jobs_count();
+        void parse_statistics_flag();
+        void parse_time_trace_file();
+        void report_compilation_statistics();
 
         void version_subcommand();
         void help_subcommand();
@@ -50,6 +58,12 @@ class CommandLineController {
         int arg_index;
 
         std::optional<std::string> target_triple;
+        std::optional<std::string> target_cpu;
+        std::optional<std::string> target_features;
+        std::optional<OptimizationLevel> optimization_level;
+        std::optional<size_t> jobs_count;
+        bool statistics_requested = false;
+        std::optional<std::string> time_trace_file;
         std::vector<std::string> inputs;
         std::vector<std::string> outputs;
 };
\ No newline at end of file
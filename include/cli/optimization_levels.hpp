@@ -0,0 +1,19 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+#include <string>
+
+enum class OptimizationLevel {
+    O0, 
+    O1, 
+    O2,
+    O3,
+    Os
+};
+
+[[nodiscard]] OptimizationLevel extract_optimization_level(
+    const std::string& flag
+);
\ No newline at end of file
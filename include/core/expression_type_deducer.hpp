@@ -10,6 +10,7 @@
 #include "core/common_feature_adoption_plan_generation_engine.hpp"
 #include "core/project_file_structure.hpp"
 #include "core/scope_context.hpp"
+#include "core/callable_code_block.hpp"
 
 class ExpressionTypeDeducer {
 
@@ -32,6 +33,7 @@ class ExpressionTypeDeducer {
         [[nodiscard]] std::optional<TypeSignature> deduce_type_from_unary_operator(const Expression& expression);
 
         [[nodiscard]] std::vector<TypeSignature> deduce_argument_types_from_function_call(const FunctionCall& function_call);
+        [[nodiscard]] CallableCodeBlock resolve_function_call(const FunctionCall& function_call);
 
         [[nodiscard]] std::optional<TypeSignature> deduce_address_operator_type(const UnaryOperator& unary_op);
         [[nodiscard]] std::optional<TypeSignature> deduce_pointer_dereference_operator_type(const UnaryOperator& unary_op);
@@ -72,6 +74,13 @@ class ExpressionTypeDeducer {
         );
 
     protected:
+        [[nodiscard]] std::optional<TypeSignature> deduce_expression_type_by_kind(const Expression& expression);
+
+        [[nodiscard]] CallableCodeBlock resolve_function_call(
+            const FunctionCall& function_call,
+            const std::vector<TypeSignature>& argument_types
+        );
+
         [[nodiscard]] TypeSignature deduce_primtive_type(
             const std::string& type_name, 
             const Expression& expression
@@ -14,6 +14,7 @@
 #include "language/functions.hpp"
 #include "core/generics_substitution_rules.hpp"
 #include "core/caching_aware_register.hpp"
+#include "core/function_specificity_descriptor.hpp"
 
 class FunctionDefinitionsRegister : public CachingAwareRegister {
 
@@ -58,6 +59,13 @@ class FunctionDefinitionsRegister : public CachingAwareRegister {
         using CachingAwareRegister::get_cache_search_key_for_func_def_retrieval_from_func_call;
         using MatchedFunctionData = std::pair<FunctionDefinition::Ref, GenericSubstitutionRule::Set::Ref>;
 
+        struct OverloadCandidate {
+            FunctionDefinition::Ref function_definition_ref;
+            FunctionSpecificityDescriptor specificity;
+        };
+
+        using OverloadSetIndex = std::unordered_map<std::string, std::vector<OverloadCandidate>>;
+
         void maybe_register_as_main_function(
             const FunctionDefinition::Ref& function_definition,
             const std::string& package_name
@@ -68,11 +76,38 @@ class FunctionDefinitionsRegister : public CachingAwareRegister {
             const std::vector<TypeSignature>& arg_types
         );
 
+        [[nodiscard]] std::vector<OverloadCandidate> collect_overload_candidates(
+            const FunctionCall& function_call,
+            const std::vector<TypeSignature>& arg_types
+        );
+
+        [[nodiscard]] OverloadSetIndex& retrieve_overload_set_index(
+            const std::string& overload_set_id
+        );
+
+        [[nodiscard]] std::string get_first_argument_category_of_function_definition(
+            const FunctionDefinition& function_definition
+        );
+
+        [[nodiscard]] std::vector<std::string> get_first_argument_categories_compatible_with(
+            const std::vector<TypeSignature>& arg_types
+        );
+
         [[nodiscard]] std::string get_new_instantiated_function_name(
             const FunctionDefinition& function_definition,
             GenericSubstitutionRule::Set::Ref generic_substitution_rules
         );
 
+        [[nodiscard]] std::string get_canonical_generic_substitution_key(
+            const FunctionDefinition& generic_function_definition,
+            GenericSubstitutionRule::Set::Ref generic_substitution_rules
+        );
+
+        [[nodiscard]] FunctionDefinition::Ref retrieve_or_instantiate_generic_function(
+            const FunctionDefinition::Ref& generic_function_definition,
+            GenericSubstitutionRule::Set::Ref generic_substitution_rules
+        );
+
         [[nodiscard]] FunctionDefinition::Ref cache_unaware_function_definition_retrieval(
             const FunctionCall& function_call, 
             const std::vector<TypeSignature>& arg_types
@@ -93,7 +128,9 @@ class FunctionDefinitionsRegister : public CachingAwareRegister {
     private:
         std::list<FunctionDefinition::Ref> function_definitions;
         std::unordered_map<std::string, FunctionDefinition::OverloadSet> function_definitions_overload_sets;
+        std::unordered_map<std::string, OverloadSetIndex> function_definitions_overload_sets_indexes;
         std::unordered_map<std::string, FunctionDefinition::Ref> fast_retrieve_cache;
+        std::unordered_map<const FunctionDefinition*, std::unordered_map<std::string, FunctionDefinition::Ref>> generic_instantiations_table;
         std::list<std::pair<FunctionDefinition::Ref, std::string>> main_function_definitions_and_their_packages;
 
         TypeDefinitionsRegister& type_definitions_register;
@@ -0,0 +1,51 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <cstdint>
+
+#include "language/typesignatures.hpp"
+
+using TypeId = uint32_t;
+
+class InternedTypesTable {
+
+    public:
+        [[nodiscard]] TypeId intern_fully_qualified_name(const std::string& fully_qualified_name);
+        [[nodiscard]] std::optional<TypeId> search_fully_qualified_name(const std::string& fully_qualified_name) const;
+        [[nodiscard]] const std::string& get_fully_qualified_name(TypeId type_id) const;
+
+        [[nodiscard]] TypeId intern_composite_type(
+            TypeSignatureBody::Kind kind, 
+            size_t array_length, 
+            std::vector<TypeId> components
+        );
+
+    protected:
+        struct CompositeTypeKey {
+            TypeSignatureBody::Kind kind;
+            size_t array_length;
+            std::vector<TypeId> components;
+
+            bool operator==(const CompositeTypeKey& other) const = default;
+        };
+
+        struct CompositeTypeKeyHash {
+            size_t operator()(const CompositeTypeKey& composite_type_key) const;
+        };
+
+        [[nodiscard]] std::string build_composite_type_fully_qualified_name(const CompositeTypeKey& composite_type_key) const;
+
+    private:
+        std::deque<std::string> fully_qualified_names;
+        std::unordered_map<std::string, TypeId> type_ids_by_fully_qualified_name;
+        std::unordered_map<CompositeTypeKey, TypeId, CompositeTypeKeyHash> type_ids_by_composite_key;
+};
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "core/scope_context.hpp"
 #include "core/caching_aware_register.hpp"
 #include "core/callable_code_block.hpp"
+#include "core/typed_expressions_table.hpp"
 
 class ProgramRepresentation {
     
@@ -24,6 +25,10 @@ class ProgramRepresentation {
             ScopeContext& arg_types
         );
 
+        [[nodiscard]] ScopeContext create_function_scope_context(
+            const FunctionDefinition& function_definition
+        );
+
         [[nodiscard]] std::list<FileRepresentation>& get_files_by_package(
             const std::string& package_name
         );
@@ -43,6 +48,22 @@ class ProgramRepresentation {
         [[nodiscard]] std::string get_fully_qualified_typedefinition_name(
             const TypeDefinition& type_definition
         );
+
+        [[nodiscard]] TypeId get_typesignature_id(
+            const TypeSignature& typesignature
+        );
+
+        [[nodiscard]] TypeId get_typedefinition_id(
+            const TypeDefinition& type_definition
+        );
+
+        [[nodiscard]] TypeId get_fully_qualified_name_id(
+            const std::string& fully_qualified_name
+        );
+
+        [[nodiscard]] const std::string& get_fully_qualified_name(
+            TypeId type_id
+        );
     
         void foreach_type_definition(
             std::function<void(const TypeDefinition&)> functor
@@ -73,11 +94,11 @@ class ProgramRepresentation {
             const TypeSignature& maybe_union_type
         );
 
-        [[nodiscard]] std::vector<TypeSignature> fetch_union_alternatives(
+        [[nodiscard]] const std::vector<TypeSignature>& fetch_union_alternatives(
             const TypeSignature& maybe_union_type
         );
 
-        [[nodiscard]] std::vector<TypeSignature> fetch_non_union_compatible_types_for_union_assignment(
+        [[nodiscard]] const std::vector<TypeSignature>& fetch_non_union_compatible_types_for_union_assignment(
             const TypeSignature& maybe_union_type
         );
 
@@ -120,4 +141,5 @@ class ProgramRepresentation {
         TypeDefinitionsRegister type_definitions_register;
         FunctionDefinitionsRegister function_definitions_register;
         CommonFeatureAdoptionPlanGenerationEngine common_feature_adoption_plan_generation_engine;
+        std::unordered_map<const FunctionDefinition*, std::shared_ptr<TypedExpressionsTable>> typed_expressions_tables;
 };
\ No newline at end of file
@@ -7,14 +7,23 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 
 #include "language/definitions.hpp"
+#include "core/scope_symbol_table.hpp"
+
+class TypedExpressionsTable;
 
 class ScopeContext {
 
     public:
-        ScopeContext() = default;
+        ScopeContext();
         ScopeContext(const FunctionDefinition& function_definition);
+        
+        ScopeContext(
+            const FunctionDefinition& function_definition, 
+            const std::shared_ptr<TypedExpressionsTable>& typed_expressions_table
+        );
 
         void store_local_variable(const VariableDeclaration& var_declaration);
         void store_local_constant(const ConstDeclaration& const_declaration);
@@ -23,20 +32,22 @@ class ScopeContext {
         [[nodiscard]] bool is_identifier_immutable(const std::string& identifier);
         [[nodiscard]] TypeSignature& get_local_object_type(const std::string& identifier);
         [[nodiscard]] ScopeContext create_nested_scope();
-        [[nodiscard]] std::string resolve_object_unique_id(const std::string& identifier);
+        [[nodiscard]] ScopeSymbolTable::SlotId resolve_object_slot_id(const std::string& identifier);
+        [[nodiscard]] TypedExpressionsTable& get_typed_expressions_table();
 
     private:
-        struct ObjectDescriptor {
-            std::string unique_scope_insensitive_id;
-            std::string identifier;
-            TypeSignature type_signature;
-            bool is_const = false; 
-            bool is_arg = false;
-        };
-
-        using MaybeObjectRef = std::optional<std::reference_wrapper<ScopeContext::ObjectDescriptor>>;
+        ScopeContext(
+            const std::shared_ptr<ScopeSymbolTable>& symbol_table,
+            ScopeSymbolTable::ScopeId scope_id,
+            const std::shared_ptr<TypedExpressionsTable>& typed_expressions_table
+        );
+
+        void store_local_object(const ScopeSymbolTable::LocalObject& local_object);
+
+        using MaybeObjectRef = std::optional<std::reference_wrapper<ScopeSymbolTable::LocalObject>>;
         [[nodiscard]] MaybeObjectRef retrieve(const std::string& identifier);
     
-        std::vector<ObjectDescriptor> local_objects;
-        ScopeContext* parent_scope = nullptr;
-};
+        std::shared_ptr<ScopeSymbolTable> symbol_table;
+        ScopeSymbolTable::ScopeId scope_id = ScopeSymbolTable::root_scope_id;
+        std::shared_ptr<TypedExpressionsTable> typed_expressions_table;
+};
\ No newline at end of file
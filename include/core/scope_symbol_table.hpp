@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "language/typesignatures.hpp"
+
+// Shared by every ScopeContext of a function: identifiers are bound to slots through
+// a flat table, and switching scope replays the undo logs of the scopes being left
+// and re-applies the declarations of the scopes being entered.
+class ScopeSymbolTable {
+
+    public:
+        using ScopeId = size_t;
+        using SlotId = size_t;
+        using IdentifierId = size_t;
+
+        inline static const ScopeId root_scope_id = 0;
+        inline static const ScopeId no_scope = std::numeric_limits<ScopeId>::max();
+        inline static const SlotId no_slot = std::numeric_limits<SlotId>::max();
+
+        struct LocalObject {
+            std::string identifier;
+            TypeSignature type_signature;
+            bool is_const = false; 
+            bool is_arg = false;
+        };
+
+        ScopeSymbolTable();
+
+        [[nodiscard]] ScopeId create_nested_scope(ScopeId parent_scope_id);
+        SlotId store_local_object(ScopeId scope_id, const LocalObject& local_object);
+        [[nodiscard]] std::optional<SlotId> lookup(ScopeId scope_id, const std::string& identifier);
+        [[nodiscard]] LocalObject& get_local_object(SlotId slot_id);
+
+    private:
+        struct ScopeFrame {
+            ScopeId parent_scope_id = no_scope;
+            size_t depth = 0;
+            std::vector<SlotId> declared_slots;
+            std::vector<std::pair<IdentifierId, SlotId>> undo_log;
+        };
+
+        [[nodiscard]] IdentifierId intern_identifier(const std::string& identifier);
+        [[nodiscard]] bool is_ancestor_or_self(ScopeId candidate_ancestor_id, ScopeId scope_id) const;
+        
+        void activate_scope(ScopeId scope_id);
+        void bind_slot_in_active_scope(ScopeId scope_id, SlotId slot_id);
+        void push_scope(ScopeId scope_id);
+        void pop_scope();
+
+        std::unordered_map<std::string, IdentifierId> interned_identifiers;
+        std::vector<IdentifierId> slots_identifiers;
+        std::vector<SlotId> visible_bindings;
+        std::deque<LocalObject> local_objects;
+        std::vector<ScopeFrame> scopes;
+        std::vector<ScopeId> active_scopes_stack;
+};
\ No newline at end of file
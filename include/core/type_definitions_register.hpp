@@ -10,6 +10,7 @@
 #include <functional>
 
 #include "core/project_file_structure.hpp"
+#include "core/interned_types_table.hpp"
 #include "language/definitions.hpp"
 #include "language/typesignatures.hpp"
 
@@ -26,16 +27,23 @@ class TypeDefinitionsRegister {
 
         [[nodiscard]] std::string get_fully_qualified_typedefinition_name(const TypeDefinition& type_definition);
         [[nodiscard]] std::string get_fully_qualified_typesignature_name(const TypeSignature& type_signature);
+
+        [[nodiscard]] TypeId get_typesignature_id(const TypeSignature& type_signature);
+        [[nodiscard]] TypeId get_typedefinition_id(const TypeDefinition& type_definition);
+        [[nodiscard]] TypeId get_fully_qualified_name_id(const std::string& fully_qualified_name);
+        [[nodiscard]] const std::string& get_fully_qualified_name(TypeId type_id);
         
         [[nodiscard]] bool is_union(const TypeSignature& maybe_union_type);
+        [[nodiscard]] bool is_union_member(const TypeSignature& union_type, const TypeSignature& candidate_member);
+        [[nodiscard]] bool is_union_subset(const TypeSignature& sub_union_type, const TypeSignature& super_union_type);
 
-
-        [[nodiscard]] std::vector<TypeSignature> fetch_union_alternatives(const TypeSignature& maybe_union_type);
-        [[nodiscard]] std::vector<TypeSignature> fetch_non_union_compatible_types_for_union_assignment(const TypeSignature& maybe_union_type);
+        [[nodiscard]] const std::vector<TypeSignature>& fetch_union_alternatives(const TypeSignature& maybe_union_type);
+        [[nodiscard]] const std::vector<TypeSignature>& fetch_non_union_compatible_types_for_union_assignment(const TypeSignature& maybe_union_type);
         [[nodiscard]] std::vector<TypeSignature> fetch_non_union_compatible_types_for_union_assignment(const UnionDefinition& union_definition);
         [[nodiscard]] std::vector<TypeSignature> fetch_non_union_compatible_types_for_union_assignment(const std::vector<TypeSignature>& alternatives);
 
     protected:
+        [[nodiscard]] TypeId get_customtype_id(const CustomType& type_signature);
         [[nodiscard]] std::string get_fully_qualified_customtype_name(const CustomType& type_signature);
         [[nodiscard]] std::optional<std::string> search_fully_qualified_typesignature_name(const CustomType&, const std::string&);
         [[nodiscard]] std::string get_type_definition_match_pattern(const std::string&, const TypeDefinition&);
@@ -43,8 +51,23 @@ class TypeDefinitionsRegister {
         [[nodiscard]] std::string infer_possible_fully_qualified_typesignature_name(const std::string&, const TypeSignature&);
         [[nodiscard]] std::string infer_possible_fully_qualified_customtype_name(const std::string &packageName, const CustomType &custom_type);
 
+        struct UnionClosure {
+            bool is_union = false;
+            bool contains_generics = false;
+            std::vector<TypeSignature> alternatives;
+            std::vector<TypeSignature> flattened_alternatives;
+            std::vector<uint64_t> flattened_alternatives_ids_bitset;
+        };
+
+        [[nodiscard]] const UnionClosure& retrieve_union_closure(const TypeSignature& maybe_union_type);
+        [[nodiscard]] std::vector<TypeSignature> compute_union_alternatives(const TypeSignature& maybe_union_type);
+        void add_flattened_alternative_to_union_closure(UnionClosure& union_closure, const TypeSignature& alternative);
+
     private:
-        std::list<std::string> type_definitions_ids;
-        std::unordered_map<std::string, TypeDefinition> type_definitions;
+        InternedTypesTable interned_types_table;
+        std::vector<TypeId> type_definitions_ids;
+        std::unordered_map<TypeId, TypeDefinition> type_definitions;
+        std::unordered_map<TypeId, UnionClosure> union_closures;
+        std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::string, TypeId>>> resolved_customtype_ids;
         ProjectFileStructure& project_file_structure;
 };
\ No newline at end of file
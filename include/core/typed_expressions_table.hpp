@@ -0,0 +1,38 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include "language/expressions.hpp"
+#include "language/functions.hpp"
+#include "core/callable_code_block.hpp"
+
+class TypedExpressionsTable {
+
+    public:
+        [[nodiscard]] bool contains_expression_type(const Expression& expression) const;
+        [[nodiscard]] const std::optional<TypeSignature>& get_expression_type(const Expression& expression) const;
+        void store_expression_type(const Expression& expression, const std::optional<TypeSignature>& type_signature);
+
+        [[nodiscard]] std::optional<CallableCodeBlock> search_resolved_function_call(const FunctionCall& function_call) const;
+        void store_resolved_function_call(const Expression& expression, const CallableCodeBlock& callable_code_block);
+
+    private:
+        struct TypedExpression {
+            Expression expression;
+            std::optional<TypeSignature> type_signature;
+        };
+
+        struct ResolvedFunctionCall {
+            Expression expression;
+            CallableCodeBlock callable_code_block;
+        };
+
+        std::unordered_map<const ExpressionBody*, TypedExpression> expression_types;
+        std::unordered_map<const ExpressionBody*, ResolvedFunctionCall> resolved_function_calls;
+};
\ No newline at end of file
@@ -20,6 +20,10 @@
 
 [[noreturn]] void throw_unrecognized_file_extension(const std::string& filename);
 
+[[noreturn]] void throw_unrecognized_optimization_level(const std::string& flag);
+
+[[noreturn]] void throw_invalid_jobs_count(const std::string& jobs_count);
+
 void avoid_lack_of_input_files(const std::vector<std::string>& input_files);
 
 void avoid_lack_of_output_files(const std::vector<std::string>& output_files);
@@ -30,8 +34,24 @@ void avoid_duplicate_output_file_extensions(std::vector<FileExtension> extension
 
 void avoid_lack_of_target_triple(const std::optional<std::string>& target_triple);
 
+void avoid_lack_of_target_cpu(const std::optional<std::string>& target_cpu);
+
+void avoid_lack_of_target_features(const std::optional<std::string>& target_features);
+
+void avoid_lack_of_jobs_count(const std::optional<std::string>& jobs_count);
+
+void avoid_lack_of_time_trace_file(const std::optional<std::string>& time_trace_file);
+
 void ensure_lack_of_target_triple(const std::optional<std::string>& target_triple);
 
+void ensure_lack_of_target_cpu(const std::optional<std::string>& target_cpu);
+
+void ensure_lack_of_target_features(const std::optional<std::string>& target_features);
+
+void ensure_lack_of_optimization_level(const std::optional<OptimizationLevel>& optimization_level);
+
+void ensure_lack_of_jobs_count(const std::optional<size_t>& jobs_count);
+
 void ensure_input_files_exist(std::vector<std::string>& input_files);
 
 void ensure_lack_of_output_files(const std::vector<std::string>& output_files);
@@ -40,5 +60,12 @@ void ensure_lack_of_input_files(const std::vector<std::string>& input_files);
 
 void ensure_source_file_is_open(const std::fstream& input_file, const std::string& file_name);
 
+void ensure_source_file_is_mapped(bool is_mapped, const std::string& file_name);
+
+void ensure_time_trace_file_is_open(const std::ofstream& time_trace_file, const std::string& file_name);
+
 void ensure_valid_target_triple(const std::string& target_triple, const std::string& error);
 
+void ensure_valid_target_cpu(const std::string& target_cpu, const std::string& target_triple, bool is_valid);
+
+void ensure_main_function_is_defined_for_jit_execution(bool main_function_is_defined);
\ No newline at end of file
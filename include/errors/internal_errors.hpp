@@ -18,6 +18,11 @@
 #include "errors/compilation_error.hpp"
 #include "core/common_feature_adoption_plan_descriptor.hpp"
 
+namespace llvm { 
+    class Module; 
+    class Error;
+}
+
 [[noreturn]] void assert_unreachable();
 
 [[noreturn]] inline void throw_unrecognized_binary_operator(const BinaryOperator& bop) {
@@ -226,10 +231,22 @@ inline void assert_local_variable_was_found_in_translation_aware_scope_context(b
     #endif
 }
 
+inline void assert_typed_expression_was_found(bool search_success) {
+    #ifndef DEBUG_BUILD
+    if (!search_success) {
+        throw std::runtime_error("the compiler expected this expression to be already typed, and it wasn't");
+    }
+    #endif
+}
+
 inline void assert_is_assignment_of_non_union_to_union(bool is_union_source, bool is_union_target) {
     #ifndef DEBUG_BUILD
     if (is_union_source || !is_union_target) {
         throw std::runtime_error("the compiler expected this assignment to be of a non-union type to a union type, and it wasn't");
     }
     #endif
-}
\ No newline at end of file
+}
+
+void assert_llvm_module_is_well_formed(const llvm::Module& llvm_module);
+
+void assert_llvm_jit_operation_succeeded(llvm::Error&& llvm_error);
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "core/scope_context.hpp"
 #include "core/generics_substitution_rules.hpp"
 #include "core/generics_instantiation_engine.hpp"
+#include "core/interned_types_table.hpp"
 #include "syntax/primitive_types.hpp"
 
 inline void ensure_assignment_is_valid(
@@ -80,7 +81,7 @@ inline void ensure_const_declaration_is_valid(
 }
 
 void ensure_no_multiple_definition_of_the_same_type(
-    const std::pair<std::unordered_map<std::string, TypeDefinition>::iterator, bool>& 
+    const std::pair<std::unordered_map<TypeId, TypeDefinition>::iterator, bool>& 
         type_definition_insertion_outcome
 );
 
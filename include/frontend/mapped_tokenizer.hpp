@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+
+#include "frontend/token.hpp"
+#include "frontend/tokenized_file.hpp"
+#include "frontend/source_files_registry.hpp"
+
+struct TokenView {
+    std::string_view sourcetext;
+    SourceFilesRegistry::FileId file_id;
+    uint32_t line_number;
+    uint32_t tok_number;
+    uint32_t char_pos;
+    Token::Type type;
+
+    [[nodiscard]] Token to_token(const SourceFilesRegistry& source_files_registry) const;
+};
+
+class MappedTokenizer {
+
+    public:
+        MappedTokenizer(SourceFilesRegistry& source_files_registry, SourceFilesRegistry::FileId file_id);
+
+        [[nodiscard]] std::vector<TokenView> tokenize_as_views();
+        [[nodiscard]] TokenizedFile tokenize();
+
+        [[nodiscard]] std::optional<TokenView> extract_number();
+        [[nodiscard]] std::optional<TokenView> extract_text();
+        [[nodiscard]] std::optional<TokenView> extract_string();
+        [[nodiscard]] std::optional<TokenView> extract_symbol();
+        [[nodiscard]] std::optional<TokenView> extract();
+
+    private:
+        SourceFilesRegistry& source_files_registry;
+        SourceFilesRegistry::FileId file_id;
+        std::string_view source_text;
+        std::string_view current_line;
+        uint32_t line_number = 0;
+        uint32_t tok_number = 0;
+        size_t char_pos = 0;
+
+        std::vector<TokenView> multiline_comments_tracker;
+        void update_multiline_comments_tracker();
+        void ignore_multiline_comments();
+        void handle_multiline_comments();
+        void handle_simple_comments();
+
+        void ignore_discardable_characters();
+        void inspect_for_unexpected_tokens();
+
+        [[nodiscard]] TokenView make_token_view(std::string_view sourcetext, const Token::Type type);
+        [[nodiscard]] DebugInformationsAwareEntity make_coordinates();
+
+        [[nodiscard]] Token::Type get_textual_token_type(std::string_view sourcetext);
+};
\ No newline at end of file
@@ -28,6 +28,8 @@ class Parser {
 
         [[nodiscard]] Expression parse_array_literal();
         [[nodiscard]] Expression parse_expression();
+        [[nodiscard]] Expression parse_expression_with_minimum_priority(short minimum_priority);
+        [[nodiscard]] Expression parse_operand_expression();
         [[nodiscard]] Expression parse_text_first_expression();
         [[nodiscard]] Expression parse_symbol_first_expression();
         [[nodiscard]] Expression parse_terminal_expression();
@@ -106,13 +108,6 @@ class Parser {
         [[nodiscard]] Expression compose_binary_operator(const Expression&);
         [[nodiscard]] Expression compose_square_bracket_access(const Expression&);
         [[nodiscard]] Expression compose_type_operator(const Expression&);
-        
-        [[nodiscard]] Expression rotate_binary_operator_to_match_operators_priority(const BinaryOperator&);
-        [[nodiscard]] Expression rotate_binary_operator_on_binary_operator_if_needed(const BinaryOperator&, const BinaryOperator&);
-        [[nodiscard]] Expression rotate_binary_operator_on_unary_operator_if_needed(const BinaryOperator&, const UnaryOperator&);
-        [[nodiscard]] Expression rotate_to_match_type_operator_priority(const TypeOperator&);
-        [[nodiscard]] Expression rotate_to_match_dot_member_access_priority(const DotMemberAccess&);
-        [[nodiscard]] Expression rotate_to_match_square_brackets_access_priority(const SquareBracketsAccess&);
 
         [[nodiscard]] bool is_template_type(const std::string& type_name);
 };
\ No newline at end of file
@@ -0,0 +1,47 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+class MappedSourceFile {
+
+    public:
+        MappedSourceFile(const std::string& file_path);
+        MappedSourceFile(const std::string& inline_input_name, std::string inline_input_text);
+        ~MappedSourceFile();
+
+        MappedSourceFile(const MappedSourceFile&) = delete;
+        MappedSourceFile& operator=(const MappedSourceFile&) = delete;
+
+        [[nodiscard]] std::string_view get_source_text() const;
+        [[nodiscard]] const std::string& get_filename() const;
+
+    private:
+        std::string filename;
+        const char* mapped_address = nullptr;
+        size_t mapped_size = 0;
+        std::string owned_source_text;
+};
+
+class SourceFilesRegistry {
+
+    public:
+        using FileId = uint32_t;
+
+        [[nodiscard]] FileId map_source_file(const std::string& file_path);
+        [[nodiscard]] FileId store_inline_input(const std::string& inline_input_name, std::string inline_input_text);
+
+        [[nodiscard]] std::string_view get_source_text(FileId file_id) const;
+        [[nodiscard]] const std::string& get_filename(FileId file_id) const;
+
+    private:
+        std::vector<std::unique_ptr<MappedSourceFile>> source_files;
+};
\ No newline at end of file
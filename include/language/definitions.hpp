@@ -40,6 +40,7 @@ struct FunctionDefinition : public DebugInformationsAwareEntity {
     std::vector<Statement> code;
     
     std::optional<std::string> extern_implementation;
+    bool is_generic_instantiation = false;
 };
 
 struct StructDefinition : public DebugInformationsAwareEntity  {
@@ -10,6 +10,7 @@
 #include <optional>
 
 #include "language/typesignatures.hpp"
+#include "misc/compilation_statistics.hpp"
 
 struct ExpressionBody : public DebugInformationsAwareEntity {
 
@@ -30,10 +31,18 @@ struct ExpressionBody : public DebugInformationsAwareEntity {
     };
 
     virtual Kind expression_kind() const = 0;
+    virtual bool is_generic() const = 0;
+
+    template<typename Implementation>
+    static constexpr Kind kind_tag_of = Implementation::expression_kind_tag;
+
     virtual ~ExpressionBody() = default;
 
     ExpressionBody(const DebugInformationsAwareEntity& debug_info)
-        : DebugInformationsAwareEntity(debug_info) { }
+        : DebugInformationsAwareEntity(debug_info) 
+    { 
+        CompilationStatistics::increment_counter(CompilationStatistics::Counter::ast_nodes);
+    }
 };
 
 class Expression : public Polymorph<ExpressionBody> {
@@ -48,7 +57,9 @@ class Expression : public Polymorph<ExpressionBody> {
         [[nodiscard]] bool is_wrapped_in_in_parenthesis() const;
         [[nodiscard]] bool is_literal() const;
         [[nodiscard]] ExpressionBody::Kind expression_kind() const;
+        [[nodiscard]] bool is_generic() const;
         [[nodiscard]] const DebugInformationsAwareEntity& as_debug_informations_aware_entity() const;
+        [[nodiscard]] const ExpressionBody& as_expression_body() const;
 
     private:
         bool wrapped_in_parenthesis = false;
@@ -56,6 +67,8 @@ class Expression : public Polymorph<ExpressionBody> {
 
 struct DotMemberAccess : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::dot_member_access;
+
     virtual ~DotMemberAccess() = default;
 
     DotMemberAccess(
@@ -65,6 +78,7 @@ struct DotMemberAccess : public ExpressionBody {
     );
 
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Expression struct_value;
     std::string member_name;
@@ -72,6 +86,8 @@ struct DotMemberAccess : public ExpressionBody {
 
 struct SquareBracketsAccess : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::square_bracket_access;
+
     virtual ~SquareBracketsAccess() = default;
 
     SquareBracketsAccess(
@@ -81,6 +97,7 @@ struct SquareBracketsAccess : public ExpressionBody {
     );
 
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Expression storage;
     Expression index;
@@ -88,6 +105,8 @@ struct SquareBracketsAccess : public ExpressionBody {
 
 struct ArrayLiteral : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::array_literal;
+
     virtual ~ArrayLiteral() = default;
 
     ArrayLiteral(
@@ -98,6 +117,7 @@ struct ArrayLiteral : public ExpressionBody {
     );
 
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::optional<size_t> array_length;
     TypeSignature stored_type;
@@ -107,6 +127,8 @@ struct ArrayLiteral : public ExpressionBody {
 
 struct TypeOperator : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::type_operator;
+
     virtual ~TypeOperator() = default;
 
     TypeOperator(
@@ -124,6 +146,7 @@ struct TypeOperator : public ExpressionBody {
 
     [[nodiscard]] Token as_token() const;
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::string operator_text;
     Expression expression;
@@ -132,6 +155,8 @@ struct TypeOperator : public ExpressionBody {
 
 struct BinaryOperator : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::binary_operator;
+
     virtual ~BinaryOperator() = default;
 
     enum class Kind {
@@ -164,10 +189,13 @@ struct BinaryOperator : public ExpressionBody {
 
     [[nodiscard]] Token as_token() const;
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 };
 
 struct UnaryOperator : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::unary_operator;
+
     enum class Kind {
         boolean_not,
         minus_sign,
@@ -191,6 +219,7 @@ struct UnaryOperator : public ExpressionBody {
 
     [[nodiscard]] Token as_token() const;
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Kind unary_op_kind;    
     std::string operator_text;
@@ -199,67 +228,85 @@ struct UnaryOperator : public ExpressionBody {
 
 struct Identifier : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::identifier;
+
     virtual ~Identifier() = default;
 
     Identifier(const Token& identifier_token);
     Identifier(const DebugInformationsAwareEntity& debug_info, const std::string& name);
 
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::string name;
 };
 
 struct StringLiteral : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::string_literal;
+
     virtual ~StringLiteral() = default;
 
     StringLiteral(const Token& string_literal_token, const std::string& value);
     
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::string value;
 };
 
 struct IntLiteral : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::int_literal;
+
     virtual ~IntLiteral() = default;
 
     IntLiteral(const Token& int_literal_token);
     
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
     
     int value;
 };
 
 struct FloatLiteral : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::float_literal;
+
     virtual ~FloatLiteral() = default;
 
     FloatLiteral(const Token& float_literal_token);
     
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
     
     double value;
 };
 
 struct BoolLiteral : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::bool_literal;
+
     virtual ~BoolLiteral() = default;
 
     BoolLiteral(const Token& bool_literal_token);
     
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
     
     bool value;
 };
 
 struct CharLiteral : public ExpressionBody {
 
+    static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::char_literal;
+
     virtual ~CharLiteral() = default;
 
     CharLiteral(const Token& char_literal_token, char value);
     
     [[nodiscard]] ExpressionBody::Kind expression_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     char value;
 };
\ No newline at end of file
@@ -12,6 +12,9 @@ struct FunctionCall
 	: public ExpressionBody 
 	, public StatementBody
 {
+	static constexpr ExpressionBody::Kind expression_kind_tag = ExpressionBody::Kind::function_call;
+	static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::function_call;
+
 	virtual ~FunctionCall() = default;
 
 	FunctionCall(
@@ -28,13 +31,15 @@ struct FunctionCall
 	);
 
 	[[nodiscard]] ExpressionBody::Kind expression_kind() const override {
-		return ExpressionBody::Kind::function_call;
+		return expression_kind_tag;
 	}
 
 	[[nodiscard]] StatementBody::Kind statement_kind() const override {
-		return StatementBody::Kind::function_call;
+		return statement_kind_tag;
 	}
 
+	[[nodiscard]] bool is_generic() const override;
+
 	std::string package_prefix;
 	std::string function_name;
 	std::vector<TypeSignature> instantiated_generics;
@@ -12,6 +12,7 @@
 #include "misc/debug_informations_aware_entity.hpp"
 #include "language/typesignatures.hpp"
 #include "language/expressions.hpp"
+#include "misc/compilation_statistics.hpp"
 
 struct StatementBody : public DebugInformationsAwareEntity {
 
@@ -31,9 +32,16 @@ struct StatementBody : public DebugInformationsAwareEntity {
     };
 
     [[nodiscard]] virtual StatementBody::Kind statement_kind() const = 0;
+    [[nodiscard]] virtual bool is_generic() const = 0;
+
+    template<typename Implementation>
+    static constexpr Kind kind_tag_of = Implementation::statement_kind_tag;
 
     StatementBody(const DebugInformationsAwareEntity& debug_info)
-        : DebugInformationsAwareEntity(debug_info) { }
+        : DebugInformationsAwareEntity(debug_info) 
+    { 
+        CompilationStatistics::increment_counter(CompilationStatistics::Counter::ast_nodes);
+    }
 };
 
 struct Statement : public Polymorph<StatementBody> {
@@ -43,10 +51,13 @@ struct Statement : public Polymorph<StatementBody> {
     using Polymorph<StatementBody>::Polymorph;
 
     [[nodiscard]] StatementBody::Kind statement_kind() const;
+    [[nodiscard]] bool is_generic() const;
 };
 
 struct VariableDeclaration : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::variable_declaration;
+
     virtual ~VariableDeclaration() = default;
 
     VariableDeclaration(
@@ -57,6 +68,7 @@ struct VariableDeclaration : public StatementBody {
     );
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::string identifier_name;
     TypeSignature typesignature;
@@ -64,7 +76,9 @@ struct VariableDeclaration : public StatementBody {
 };
 
 struct ConstDeclaration : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::const_declaration;
+
     virtual ~ConstDeclaration() = default;
 
     ConstDeclaration(
@@ -75,6 +89,7 @@ struct ConstDeclaration : public StatementBody {
     );
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::string identifier_name;
     TypeSignature typesignature;
@@ -82,7 +97,9 @@ struct ConstDeclaration : public StatementBody {
 };
 
 struct Assignment : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::assignment;
+
     virtual ~Assignment() = default;
 
     Assignment(
@@ -92,13 +109,16 @@ struct Assignment : public StatementBody {
     );
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Expression assignment_target;
     Expression assigned_value;
 };
 
 struct Conditional : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::conditional;
+
     virtual ~Conditional() = default;
 
     Conditional(
@@ -109,6 +129,7 @@ struct Conditional : public StatementBody {
     );
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Expression condition;
     std::vector<Statement> then_branch;
@@ -116,7 +137,9 @@ struct Conditional : public StatementBody {
 };
 
 struct WhileLoop : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::while_loop;
+
     virtual ~WhileLoop() = default;
 
     WhileLoop(
@@ -126,6 +149,7 @@ struct WhileLoop : public StatementBody {
     );
     
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Expression condition;
     std::vector<Statement> loop_body;
@@ -133,6 +157,8 @@ struct WhileLoop : public StatementBody {
 
 struct UntilLoop : public StatementBody {
 
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::until_loop;
+
     virtual ~UntilLoop() = default;
 
     UntilLoop(
@@ -142,13 +168,16 @@ struct UntilLoop : public StatementBody {
     );
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Expression condition;
     std::vector<Statement> loop_body;
 };
 
 struct Return : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::return_statement;
+
     virtual ~Return() = default;
 
     Return(
@@ -157,24 +186,31 @@ struct Return : public StatementBody {
     );
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     std::optional<Expression> return_value;
 };
 
 struct Continue : public StatementBody {
-    
+
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::continue_statement;
+
     virtual ~Continue() = default;
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Continue(const Token& continue_token);    
 };
 
 struct Break : public StatementBody {
 
+    static constexpr StatementBody::Kind statement_kind_tag = StatementBody::Kind::break_statement;
+
     virtual ~Break() = default;
 
     [[nodiscard]] StatementBody::Kind statement_kind() const override;
+    [[nodiscard]] bool is_generic() const override;
 
     Break(const Token& break_token);  
 };
\ No newline at end of file
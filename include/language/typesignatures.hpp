@@ -28,6 +28,9 @@ struct TypeSignatureBody : public DebugInformationsAwareEntity {
 
     [[nodiscard]] virtual Kind typesiganture_kind() const = 0;
     [[nodiscard]] virtual bool is_generic() const = 0;
+
+    template<typename Implementation>
+    static constexpr Kind kind_tag_of = Implementation::typesignature_kind_tag;
 };
 
 struct TypeSignature : public Polymorph<TypeSignatureBody> {
@@ -42,6 +45,8 @@ struct TypeSignature : public Polymorph<TypeSignatureBody> {
 
 struct CustomType : public TypeSignatureBody {
 
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::custom_type;
+
     virtual ~CustomType() = default;
 
     CustomType(const Token& typename_token, const std::vector<TypeSignature>& generics);
@@ -56,6 +61,8 @@ struct CustomType : public TypeSignatureBody {
 
 struct InlineUnion : public TypeSignatureBody {
 
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::inline_union;
+
     virtual ~InlineUnion() = default;
 
     InlineUnion(const DebugInformationsAwareEntity& typename_token, const std::vector<TypeSignature>& alternatives);
@@ -68,6 +75,8 @@ struct InlineUnion : public TypeSignatureBody {
 
 struct TemplateType : public TypeSignatureBody {
 
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::template_type;
+
     virtual ~TemplateType() = default;
 
     TemplateType(const Token& typename_token); 
@@ -79,7 +88,9 @@ struct TemplateType : public TypeSignatureBody {
 };
 
 struct PrimitiveType : public TypeSignatureBody {
- 
+
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::primitive_type;
+
     virtual ~PrimitiveType() = default;
 
     PrimitiveType(const Token& typename_token);
@@ -92,7 +103,9 @@ struct PrimitiveType : public TypeSignatureBody {
 };
 
 struct PointerType : public TypeSignatureBody {
-    
+
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::pointer_type;
+
     PointerType(const DebugInformationsAwareEntity& pointer_symbol_token, const TypeSignature& pointed);
 
     [[nodiscard]] virtual TypeSignatureBody::Kind typesiganture_kind() const;
@@ -102,7 +115,9 @@ struct PointerType : public TypeSignatureBody {
 };
 
 struct ArrayType : public TypeSignatureBody {
-    
+
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::array_type;
+
     ArrayType(const DebugInformationsAwareEntity& array_open_square_bracket_token, size_t length, const TypeSignature& stored);
 
     [[nodiscard]] virtual TypeSignatureBody::Kind typesiganture_kind() const;
@@ -113,7 +128,9 @@ struct ArrayType : public TypeSignatureBody {
 };
 
 struct SliceType : public TypeSignatureBody {
-    
+
+    static constexpr TypeSignatureBody::Kind typesignature_kind_tag = TypeSignatureBody::Kind::slice_type;
+
     SliceType(const Token& slice_symbol_token, const TypeSignature& stored);
 
     [[nodiscard]] virtual TypeSignatureBody::Kind typesiganture_kind() const;
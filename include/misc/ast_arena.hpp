@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// bump allocator holding the AST nodes (expressions, statements and typesignatures) of a single
+// compilation. Nodes are never released one at a time: when the arena is destroyed, every node
+// it holds is destroyed too, and its chunks are freed. The arena is only used by the threads on
+// which an `AstArena::Scope` is alive (e.g. while parsing); nodes built anywhere else, such as
+// the typesignatures deduced while typechecking, are heap-allocated and released as soon as
+// nothing refers to them anymore (see `Polymorph`).
+class AstArena {
+
+    private:
+        struct Shard;
+
+    public:
+        // makes the current thread build its nodes in the given arena while alive. Each scope
+        // fills its own chunks, so that threads sharing the same arena never contend for it
+        class Scope {
+
+            public:
+                Scope(AstArena& arena);
+                ~Scope();
+
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+            private:
+                Shard* previous_shard;
+        };
+
+        AstArena() = default;
+        ~AstArena();
+
+        AstArena(const AstArena&) = delete;
+        AstArena& operator=(const AstArena&) = delete;
+
+        template<typename Node>
+        [[nodiscard]] static Node* allocate(const Node& node) {
+            Node* allocated_node = new (current_shard->allocate_bytes(sizeof(Node), alignof(Node))) Node(node);
+            current_shard->node_destructors.push_back(NodeDestructor {
+                allocated_node, [](void* node) { static_cast<Node*>(node)->~Node(); }
+            });
+            return allocated_node;
+        }
+
+        [[nodiscard]] static bool is_in_use_by_current_thread();
+        [[nodiscard]] size_t get_reserved_bytes();
+
+    private:
+        struct NodeDestructor {
+            void* node;
+            void (*destroy)(void*);
+        };
+
+        struct Shard {
+            [[nodiscard]] void* allocate_bytes(size_t size, size_t alignment);
+
+            size_t reserved_bytes = 0;
+            std::byte* chunk_cursor = nullptr;
+            std::byte* chunk_end = nullptr;
+            std::vector<std::unique_ptr<std::byte[]>> chunks;
+            std::vector<NodeDestructor> node_destructors;
+        };
+
+        static constexpr size_t chunk_size = 64 * 1024;
+        static thread_local Shard* current_shard;
+
+        std::mutex shards_mutex;
+        std::vector<std::unique_ptr<Shard>> shards;
+};
\ No newline at end of file
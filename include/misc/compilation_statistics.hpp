@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <string>
+
+class CompilationStatistics {
+
+    public:
+        enum class Counter {
+            tokens,
+            ast_nodes,
+            ast_arena_bytes,
+            overload_resolutions,
+            fast_retrieve_cache_hits,
+            generic_instantiations,
+            instantiation_table_hits,
+            llvm_functions_emitted,
+            counters_count
+        };
+
+        static void increment_counter(Counter counter, size_t amount = 1) {
+            counters[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static size_t get_counter(Counter counter);
+        [[nodiscard]] static std::string get_counter_name(Counter counter);
+
+        static void record_timed_phase(
+            const std::string& phase_name,
+            const std::string& detail,
+            std::chrono::steady_clock::time_point start_instant,
+            std::chrono::steady_clock::time_point end_instant
+        );
+
+        static void reset();
+        static void print_summary(std::ostream& output_stream);
+        static void write_chrome_trace(std::ostream& output_stream);
+
+    private:
+        static std::array<std::atomic<size_t>, static_cast<size_t>(Counter::counters_count)> counters;
+};
+
+class ScopedPhaseTimer {
+
+    public:
+        ScopedPhaseTimer(const std::string& phase_name, const std::string& detail = "");
+        ~ScopedPhaseTimer();
+
+        ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+        ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+    private:
+        std::string phase_name;
+        std::string detail;
+        std::chrono::steady_clock::time_point start_instant;
+};
\ No newline at end of file
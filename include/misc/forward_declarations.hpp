@@ -13,7 +13,7 @@ struct TypeSignature;
 struct Expression;
 
 void assert_get_operation_is_possible(
-    const char* wanted_type, 
+    bool is_operation_possible, 
     const std::type_info& type_info
 );
 
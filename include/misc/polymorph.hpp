@@ -6,41 +6,46 @@
 #pragma once
 
 #include "misc/forward_declarations.hpp"
+#include "misc/ast_arena.hpp"
 
 #include <memory>
-#include <string>
+#include <type_traits>
 
+// handle to an AST node, tagged with the node's kind (as declared by `Interface::kind_tag_of`),
+// which is everything `is<T>()` needs to answer and what `switch`-based dispatch is built upon.
+// Nodes built while an AstArena is in use by the current thread live in that arena, and copying
+// their handles only copies a pointer; every other node is heap-allocated and shared by all of
+// its handles, which release it when the last one goes away. Whether the node mentions any
+// template type is also computed once, when the node is built out of its (already built)
+// children, so that asking it again never walks the subtree.
 template<typename Interface>
 class Polymorph {
     
     public:
-        Polymorph(const Polymorph& other)
-            : ptr(other.ptr), cpp_type_info_str(other.cpp_type_info_str) { }
+        using Kind = typename Interface::Kind;
+
+        Polymorph(const Polymorph& other) = default;
 
         template<typename Implementation>
-        Polymorph(const Implementation& type)
-            requires(std::is_base_of_v<Interface, Implementation>) {
-                ptr = std::make_shared<Implementation>(type);
-                cpp_type_info_str = typeid(Implementation).name();
-        }
+        Polymorph(const Implementation& node)
+            requires(std::is_base_of_v<Interface, Implementation>) 
+            : ptr(allocate(node))
+            , kind_tag(Interface::template kind_tag_of<Implementation>)
+            , generic_bit(node.is_generic()) { }
 
-        Polymorph& operator=(const Polymorph& other) {
-            ptr = other.ptr;
-            cpp_type_info_str = other.cpp_type_info_str;
-            return *this;
-        }
+        Polymorph& operator=(const Polymorph& other) = default;
 
         template<typename Implementation>
         bool is() const
             requires(std::is_base_of_v<Interface, Implementation>) {
-                return cpp_type_info_str == typeid(Implementation).name();
+                return kind_tag == Interface::template kind_tag_of<Implementation>;
         }
 
         template<typename Implementation>
         const Implementation& get() const
             requires(std::is_base_of_v<Interface, Implementation>) {
-                assert_get_operation_is_possible(cpp_type_info_str, typeid(Implementation));
-                return *static_cast<Implementation*>(ptr.get());
+                assert_get_operation_is_possible(is<Implementation>(), typeid(Implementation));
+                return *static_cast<const Implementation*>(ptr.get());
         }
 
         template<typename Implementation>
@@ -52,6 +57,16 @@ class Polymorph {
         }
 
     protected:
+        template<typename Implementation>
+        static std::shared_ptr<Interface> allocate(const Implementation& node) {
+            if (AstArena::is_in_use_by_current_thread()) {
+                std::shared_ptr<Interface> no_owner;
+                return std::shared_ptr<Interface>(no_owner, AstArena::allocate(node));
+            }
+            return std::make_shared<Implementation>(node);
+        }
+
         std::shared_ptr<Interface> ptr;
-        const char* cpp_type_info_str;
-};
+        Kind kind_tag;
+        bool generic_bit;
+};
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <set>
 
 inline const std::string constexpr int_type        = "Int";
+inline const std::string constexpr int32_type      = "Int32";
 inline const std::string constexpr float_type      = "Float";
 inline const std::string constexpr bool_type       = "Bool";
 inline const std::string constexpr char_type       = "Char";
@@ -17,6 +18,7 @@ inline const std::string constexpr raw_string_type = "RawString";
 
 inline const std::set<std::string> primitive_types {
     int_type,
+    int32_type,
     float_type,
     bool_type,
     char_type,
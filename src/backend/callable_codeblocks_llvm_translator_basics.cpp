@@ -4,15 +4,19 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "backend/callable_codeblocks_llvm_translator.hpp"
+#include "backend/llvm_wrappers.hpp"
+#include "misc/compilation_statistics.hpp"
 
 CallableCodeBlocksLLVMTranslator::CallableCodeBlocksLLVMTranslator(
     ProgramRepresentation& program_representation, 
     TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator,
+    LiteralsPool& literals_pool,
     llvm::LLVMContext& llvm_context,
     llvm::Module& llvm_module
 )
     : program_representation(program_representation) 
     , type_definitions_llvm_translator(type_definitions_llvm_translator)
+    , literals_pool(literals_pool)
     , llvm_context(llvm_context)
     , llvm_module(llvm_module)
 { }
@@ -40,23 +44,28 @@ llvm::Function* CallableCodeBlocksLLVMTranslator::translate_local_function_defin
     const FunctionDefinition::Ref& function_definition, 
     llvm::Function* llvm_function
 ) {
-    ScopeContext raw_scope_context(*function_definition);
-    auto local_variables = std::make_shared<std::map<std::string, llvm::AllocaInst*>>();
+    ScopeContext raw_scope_context = program_representation.create_function_scope_context(*function_definition);
+    auto local_variables = std::make_shared<std::vector<llvm::Value*>>();
+    TranslationAwareScopeContext scope_context(raw_scope_context, local_variables);
     llvm::BasicBlock* entry_block = llvm::BasicBlock::Create(llvm_context, "entry", llvm_function);
     llvm::IRBuilder<> entry_builder(entry_block);
+    FrameSlotsAllocator frame_slots_allocator(entry_block);
     for (size_t arg_index = 0; arg_index < function_definition->arguments.size(); arg_index++) {
         const TypeSignature& arg_type = function_definition->arguments[arg_index].arg_type;
         const std::string& arg_name = function_definition->arguments[arg_index].arg_name;
         llvm::Type* llvm_arg_type = type_definitions_llvm_translator
             .translate_typesignature_to_llvm_type(arg_type);
-        llvm::AllocaInst* alloca_inst = entry_builder.CreateAlloca(llvm_arg_type, nullptr);
-        entry_builder.CreateStore(llvm_function->getArg(arg_index), alloca_inst);
-        std::string arg_id = raw_scope_context.resolve_object_unique_id(arg_name);
-        local_variables->insert({arg_id, alloca_inst});
+        llvm::AllocaInst* alloca_inst = frame_slots_allocator.allocate_frame_slot(llvm_arg_type);
+        llvm::Value* llvm_arg = llvm_function->getArg(arg_index);
+        TranslatedExpression translated_arg = (llvm_arg_type->isAggregateType())
+            ? TranslatedExpression(nullptr, llvm_arg)
+            : TranslatedExpression(llvm_arg);
+        create_store_or_aggregate_copy(entry_builder, translated_arg, alloca_inst, false);
+        scope_context.bind_slot_to_allocation(raw_scope_context.resolve_object_slot_id(arg_name), alloca_inst);
     }
-    TranslationAwareScopeContext scope_context(raw_scope_context, local_variables);
     ExpressionsAndStatementsLLVMTranslator body_translator = get_function_body_translator(
         scope_context, 
+        frame_slots_allocator,
         function_definition->return_type, 
         llvm_module,
         llvm_function, 
@@ -80,9 +89,15 @@ llvm::Function* CallableCodeBlocksLLVMTranslator::translate_callable_code_block_
     const std::vector<TypeSignature>& arg_types = callable_code_block.get_arg_types();
     const bool constexpr is_vararg = false;
     std::vector<llvm::Type*> llvm_arg_types = type_definitions_llvm_translator.translate_all_types_to_llvm_types(arg_types);
+    for (size_t arg_index = 0; arg_index < arg_types.size(); arg_index++) {
+        if (is_argument_passed_by_address(callable_code_block, arg_types[arg_index])) {
+            llvm_arg_types[arg_index] = llvm_arg_types[arg_index]->getPointerTo();
+        }
+    }
     auto function_signature = llvm::FunctionType::get(llvm_return_type, llvm_arg_types, is_vararg);
-    auto linkage_policy = llvm::Function::ExternalLinkage;
+    auto linkage_policy = get_linkage_policy(callable_code_block);
     llvm::Function* llvm_function = llvm::Function::Create(function_signature, linkage_policy, llvm_func_name, llvm_module);
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::llvm_functions_emitted);
     llvm_functions.insert({llvm_func_name, llvm_function});
     switch (callable_code_block.callable_codeblock_kind()) {
         case CallableCodeBlock::Kind::function_definition: 
@@ -97,9 +112,39 @@ llvm::Function* CallableCodeBlocksLLVMTranslator::translate_callable_code_block_
     assert_unreachable();
 }
 
+llvm::GlobalValue::LinkageTypes CallableCodeBlocksLLVMTranslator::get_linkage_policy(
+    const CallableCodeBlock& callable_code_block
+) {
+    if (!callable_code_block.is<FunctionDefinition::Ref>()) {
+        return llvm::Function::InternalLinkage;
+    }
+    const FunctionDefinition::Ref& function_definition = callable_code_block.get<FunctionDefinition::Ref>();
+    bool is_program_entry_point = callable_code_block.unique_context_independent_id == "main";
+    bool is_extern_function = function_definition->extern_implementation.has_value();
+    if (is_program_entry_point || is_extern_function) {
+        return llvm::Function::ExternalLinkage;
+    }
+    return (function_definition->is_generic_instantiation)
+        ? llvm::Function::LinkOnceODRLinkage
+        : llvm::Function::InternalLinkage;
+}
+
+bool CallableCodeBlocksLLVMTranslator::is_argument_passed_by_address(
+    const CallableCodeBlock& callable_code_block,
+    const TypeSignature& arg_type
+) {
+    bool is_extern_function = 
+        callable_code_block.is<FunctionDefinition::Ref>() &&
+        callable_code_block.get<FunctionDefinition::Ref>()->extern_implementation.has_value();
+    return !is_extern_function && type_definitions_llvm_translator
+        .translate_typesignature_to_llvm_type(arg_type)
+        ->isAggregateType();
+}
+
 ExpressionsAndStatementsLLVMTranslator 
 CallableCodeBlocksLLVMTranslator::get_function_body_translator(
     TranslationAwareScopeContext scope_context,
+    FrameSlotsAllocator& frame_slots_allocator,
     std::optional<TypeSignature> expected_return_type,
     llvm::Module& llvm_module,
     llvm::Function* llvm_function,
@@ -108,7 +153,9 @@ CallableCodeBlocksLLVMTranslator::get_function_body_translator(
     return ExpressionsAndStatementsLLVMTranslator(
         program_representation, 
         type_definitions_llvm_translator,
+        literals_pool,
         *this,
+        frame_slots_allocator,
         scope_context,
         expected_return_type,
         llvm_context,
@@ -121,10 +168,14 @@ void CallableCodeBlocksLLVMTranslator::inject_return_statement_if_needed(
     llvm::BasicBlock* exit_block,
     const std::optional<TypeSignature>& return_type
 ) {
-    bool missing_void_ret = exit_block->empty();
-    missing_void_ret |= exit_block->back().getOpcode() != llvm::Instruction::Ret;
-    if (!return_type.has_value() && missing_void_ret) {
-        llvm::IRBuilder<> exit_builder(exit_block);
+    if (exit_block->getTerminator() != nullptr) {
+        return;
+    }
+    llvm::IRBuilder<> exit_builder(exit_block);
+    if (!return_type.has_value()) {
         exit_builder.CreateRetVoid();
     }
+    else {
+        exit_builder.CreateUnreachable();
+    }
 }
\ No newline at end of file
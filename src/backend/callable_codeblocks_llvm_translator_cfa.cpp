@@ -5,14 +5,18 @@
 
 #include "backend/callable_codeblocks_llvm_translator.hpp"
 #include "backend/type_manipulations_llvm_translator.hpp"
+#include "backend/llvm_wrappers.hpp"
 #include "errors/internal_errors.hpp"
 
+#include <set>
+
 llvm::Function* CallableCodeBlocksLLVMTranslator::translate_cfa_descriptor_to_llvm(
     const CommonFeatureAdoptionPlanDescriptor& descriptor, 
     llvm::Function* llvm_function
 ) {
     llvm::BasicBlock* entry_block = llvm::BasicBlock::Create(llvm_context, "entry", llvm_function);
-    translate_cfa_plan_to_llvm(descriptor, descriptor.plan, llvm_function, entry_block);
+    FrameSlotsAllocator frame_slots_allocator(entry_block);
+    translate_cfa_plan_to_llvm(descriptor, descriptor.plan, llvm_function, entry_block, frame_slots_allocator);
     return llvm_function;
 }
 
@@ -20,72 +24,81 @@ void CallableCodeBlocksLLVMTranslator::translate_cfa_plan_to_llvm(
     const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor, 
     const CommonFeatureAdoptionPlan& cfa_plan,
     llvm::Function* llvm_function,
-    llvm::BasicBlock* block
+    llvm::BasicBlock* block,
+    FrameSlotsAllocator& frame_slots_allocator
 ) {
     if (cfa_plan.is_direct_adoption()) {
         FunctionDefinition::Ref selected_concrete_function = cfa_plan.get_direct_adoption();
-        translate_cfa_direct_adoption_to_llvm(cfa_plan_descriptor, selected_concrete_function, llvm_function, block);
+        translate_cfa_direct_adoption_to_llvm(cfa_plan_descriptor, selected_concrete_function, llvm_function, block, frame_slots_allocator);
         return;
     }
     assert(cfa_plan.is_recursive_adoption());
     RecursiveAdoptionPlan recursive_plan = cfa_plan.get_recursive_adoption();
-    translate_cfa_recursive_adoption_to_llvm(cfa_plan_descriptor, recursive_plan, llvm_function, block);
+    translate_cfa_recursive_adoption_to_llvm(cfa_plan_descriptor, recursive_plan, llvm_function, block, frame_slots_allocator);
 }
 
 void CallableCodeBlocksLLVMTranslator::translate_cfa_recursive_adoption_to_llvm(
     const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor, 
     const RecursiveAdoptionPlan& recursive_plan,
     llvm::Function* llvm_function,
-    llvm::BasicBlock* block
+    llvm::BasicBlock* block,
+    FrameSlotsAllocator& frame_slots_allocator
 ) {
-    std::vector<llvm::BasicBlock*> alternative_blocks { block };
-    for (size_t alternative_index = 1; alternative_index < recursive_plan.alternatives.size(); alternative_index++) {
-        llvm::BasicBlock* prev_block = alternative_blocks.back();
+    std::vector<llvm::BasicBlock*> alternative_blocks;
+    llvm::BasicBlock* prev_block = block;
+    for (size_t alternative_index = 0; alternative_index < recursive_plan.alternatives.size(); alternative_index++) {
         llvm::BasicBlock* alternative_block = llvm::BasicBlock::Create(llvm_context, "", llvm_function);
         alternative_block->moveAfter(prev_block);
         alternative_blocks.push_back(alternative_block);
+        prev_block = alternative_block;
     }
+    TranslatedExpression llvm_argument = translate_cfa_argument_to_llvm(cfa_plan_descriptor, llvm_function, recursive_plan.argument_index);
+    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
+    llvm::Value* argument_type_tag = type_operators_llvm_translator.extract_type_tag_from_union_in_llvm(block, llvm_argument);
+    llvm::IRBuilder<> dispatch_builder(block);
+    llvm::SwitchInst* dispatch = dispatch_builder.CreateSwitch(argument_type_tag, alternative_blocks.back());
+    std::set<uint64_t> already_dispatched_type_tags;
     for (size_t alternative_index = 0; alternative_index < recursive_plan.alternatives.size() - 1; alternative_index++) {
+        std::vector<llvm::ConstantInt*> alternative_type_tags = type_definitions_llvm_translator
+            .fetch_all_type_tags_matching_type(recursive_plan.alternatives[alternative_index]);
+        for (llvm::ConstantInt* alternative_type_tag : alternative_type_tags) {
+            if (already_dispatched_type_tags.insert(alternative_type_tag->getZExtValue()).second) {
+                dispatch->addCase(alternative_type_tag, alternative_blocks[alternative_index]);
+            }
+        }
+    }
+    for (size_t alternative_index = 0; alternative_index < recursive_plan.alternatives.size(); alternative_index++) {
+        const CommonFeatureAdoptionPlan& alternative_plan = recursive_plan.nested_plans[alternative_index];
         llvm::BasicBlock* alternative_block = alternative_blocks[alternative_index];
-        llvm::IRBuilder<> alternative_block_builder(alternative_block);
-        llvm::Value* llvm_argument = llvm_function->getArg(recursive_plan.argument_index);
-        TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator);
-        TranslatedExpression is_operator = type_operators_llvm_translator.test_concrete_type_of_union_in_llvm(
-            alternative_block, 
-            llvm_argument, 
-            recursive_plan.alternatives[alternative_index]
-        );
-        llvm::BasicBlock* success_block = llvm::BasicBlock::Create(llvm_context, "", llvm_function);
-        success_block->moveAfter(alternative_block);
-        alternative_block_builder.CreateCondBr(is_operator.value, success_block, alternative_blocks[alternative_index + 1]);
-        const CommonFeatureAdoptionPlan& successful_plan = recursive_plan.nested_plans[alternative_index];
-        translate_cfa_plan_to_llvm(cfa_plan_descriptor, successful_plan, llvm_function, success_block);
+        translate_cfa_plan_to_llvm(cfa_plan_descriptor, alternative_plan, llvm_function, alternative_block, frame_slots_allocator);
     }
-    llvm::BasicBlock* last_alternative_block = alternative_blocks.back();
-    const CommonFeatureAdoptionPlan& last_alternative_plan = recursive_plan.nested_plans.back();
-    translate_cfa_plan_to_llvm(cfa_plan_descriptor, last_alternative_plan, llvm_function, last_alternative_block);
 }
 
 void CallableCodeBlocksLLVMTranslator::translate_cfa_direct_adoption_to_llvm(
     const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor,
     const FunctionDefinition::Ref& selected_concrete_function,
     llvm::Function* llvm_function,
-    llvm::BasicBlock* block
+    llvm::BasicBlock* block,
+    FrameSlotsAllocator& frame_slots_allocator
 ) {
     llvm::IRBuilder<> llvm_builder(block);
     auto ccblock = CallableCodeBlock(selected_concrete_function, program_representation);
     llvm::Function* concrete_function = translate_callable_code_block_to_llvm(ccblock);
     std::vector<llvm::Value*> arguments;
-    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator);
+    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
     for (size_t arg_index = 0; arg_index < selected_concrete_function->arguments.size(); arg_index++) {
         const TypeSignature& expected_arg_type = selected_concrete_function->arguments[arg_index].arg_type;
         TranslatedExpression cast_result = type_operators_llvm_translator.cast_translated_expression_to_another_type_in_llvm(
             llvm_builder.GetInsertBlock(), 
-            llvm_function->getArg(arg_index), 
+            translate_cfa_argument_to_llvm(cfa_plan_descriptor, llvm_function, arg_index), 
             cfa_plan_descriptor.arg_types[arg_index],
             expected_arg_type
         );
-        arguments.push_back(cast_result.value);
+        arguments.push_back(
+            (is_argument_passed_by_address(ccblock, expected_arg_type))
+                ? get_llvm_address(llvm_builder, frame_slots_allocator, cast_result)
+                : get_llvm_value(llvm_builder, cast_result)
+        );
     }
     TranslatedExpression return_value = llvm_builder.CreateCall(concrete_function, arguments);
     if (!cfa_plan_descriptor.return_type.has_value()) {
@@ -98,5 +111,18 @@ void CallableCodeBlocksLLVMTranslator::translate_cfa_direct_adoption_to_llvm(
         selected_concrete_function->return_type.value(),
         cfa_plan_descriptor.return_type.value()
     );
-    llvm_builder.CreateRet(casted_ret.value);
+    llvm_builder.CreateRet(get_llvm_value(llvm_builder, casted_ret));
+}
+
+TranslatedExpression CallableCodeBlocksLLVMTranslator::translate_cfa_argument_to_llvm(
+    const CommonFeatureAdoptionPlanDescriptor& cfa_plan_descriptor,
+    llvm::Function* llvm_function,
+    size_t arg_index
+) {
+    llvm::Value* llvm_argument = llvm_function->getArg(arg_index);
+    llvm::Type* llvm_arg_type = type_definitions_llvm_translator
+        .translate_typesignature_to_llvm_type(cfa_plan_descriptor.arg_types[arg_index]);
+    return (llvm_arg_type->isAggregateType())
+        ? TranslatedExpression(nullptr, llvm_argument)
+        : TranslatedExpression(llvm_argument);
 }
\ No newline at end of file
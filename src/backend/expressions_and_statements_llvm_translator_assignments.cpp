@@ -6,18 +6,18 @@
 #include "backend/expressions_and_statements_llvm_translator.hpp"
 #include "backend/callable_codeblocks_llvm_translator.hpp"
 #include "backend/type_manipulations_llvm_translator.hpp"
+#include "backend/llvm_wrappers.hpp"
 
 llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_variable_declaration_to_llvm(
     llvm::BasicBlock* block,
     const VariableDeclaration& variable_declaration
 ) {
     llvm::Type* llvm_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(variable_declaration.typesignature);
-    llvm::IRBuilder<> builder(block);
-    llvm::AllocaInst* alloca_inst = builder.CreateAlloca(llvm_type, nullptr);
+    llvm::AllocaInst* alloca_inst = frame_slots_allocator.allocate_frame_slot(llvm_type);
     scope_context.store_local_variable(variable_declaration, alloca_inst);
     if (variable_declaration.initial_value.has_value()) {
         Identifier identifier(variable_declaration, variable_declaration.identifier_name);
-        translate_assignment_to_llvm(block, identifier, variable_declaration.initial_value.value());
+        block = translate_assignment_to_llvm(block, identifier, variable_declaration.initial_value.value());
     }
     return block;
 }
@@ -27,24 +27,29 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_constant_dec
     const ConstDeclaration& const_declaration
 ) {
     llvm::Type* llvm_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(const_declaration.typesignature);
-    llvm::IRBuilder<> builder(block);
-    llvm::AllocaInst* alloca_inst = builder.CreateAlloca(llvm_type, nullptr);
+    llvm::Constant* constant_value = (const_declaration.value.expression_kind() == ExpressionBody::Kind::array_literal)
+        ? translate_constant_array_literal_to_llvm(const_declaration.value.get<ArrayLiteral>())
+        : nullptr;
+    if (constant_value != nullptr && constant_value->getType() == llvm_type) {
+        llvm::GlobalVariable* global_array = literals_pool.intern_constant_array(constant_value);
+        scope_context.store_local_constant(const_declaration, global_array);
+        return block;
+    }
+    llvm::AllocaInst* alloca_inst = frame_slots_allocator.allocate_frame_slot(llvm_type);
     scope_context.store_local_constant(const_declaration, alloca_inst);
     Identifier identifier(const_declaration, const_declaration.identifier_name);
-    translate_assignment_to_llvm(block, identifier, const_declaration.value);
-    return block;
+    return translate_assignment_to_llvm(block, identifier, const_declaration.value);
 }
 
 llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_assignment_to_llvm(
     llvm::BasicBlock* block,
     const Assignment& assignment
 ) {
-    translate_assignment_to_llvm(
+    return translate_assignment_to_llvm(
         block,
         assignment.assignment_target, 
         assignment.assigned_value
     );
-    return block;
 }
 
 llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_assignment_to_llvm(
@@ -61,7 +66,7 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_assignment_t
     TranslatedExpression translated_target = translate_expression_to_llvm(block, target);
     TranslatedExpression translated_source = translate_expression_to_llvm(block, source);
     llvm::IRBuilder<> builder(block);
-    TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator);
+    TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
     TranslatedExpression casted_source = type_manipulations_llvm_translator.cast_translated_expression_to_another_type_in_llvm(
         block,
         translated_source,
@@ -69,6 +74,6 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_assignment_t
         target_type
     );
     assert(translated_target.address != nullptr);
-    builder.CreateStore(casted_source.value, translated_target.address);
+    create_store_or_aggregate_copy(builder, casted_source, translated_target.address, true);
     return block;
 }
\ No newline at end of file
@@ -6,11 +6,14 @@
 #include "backend/expressions_and_statements_llvm_translator.hpp"
 #include "backend/callable_codeblocks_llvm_translator.hpp"
 #include "backend/type_manipulations_llvm_translator.hpp"
+#include "backend/llvm_wrappers.hpp"
 
 ExpressionsAndStatementsLLVMTranslator::ExpressionsAndStatementsLLVMTranslator(
     ProgramRepresentation& program_representation, 
     TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator,
+    LiteralsPool& literals_pool,
     CallableCodeBlocksLLVMTranslator& callable_codeblocks_llvm_translator,
+    FrameSlotsAllocator& frame_slots_allocator,
     TranslationAwareScopeContext scope_context,
     std::optional<TypeSignature> expected_return_type,
     llvm::LLVMContext& context,
@@ -20,7 +23,9 @@ ExpressionsAndStatementsLLVMTranslator::ExpressionsAndStatementsLLVMTranslator(
 )
     : program_representation(program_representation)
     , type_definitions_llvm_translator(type_definitions_llvm_translator)
+    , literals_pool(literals_pool)
     , callable_codeblocks_llvm_translator(callable_codeblocks_llvm_translator)
+    , frame_slots_allocator(frame_slots_allocator)
     , scope_context(scope_context)
     , expected_return_type(expected_return_type)
     , context(context)
@@ -37,7 +42,9 @@ ExpressionsAndStatementsLLVMTranslator::create_translator_for_nested_loop(
     return ExpressionsAndStatementsLLVMTranslator(
         program_representation, 
         type_definitions_llvm_translator, 
+        literals_pool,
         callable_codeblocks_llvm_translator, 
+        frame_slots_allocator,
         scope_context.create_nested_scope(), 
         expected_return_type,
         context,
@@ -53,15 +60,16 @@ ExpressionsAndStatementsLLVMTranslator::create_translator_for_nested_conditional
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_expr_function_call_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const FunctionCall& fcall
 ) {
     CallableCodeBlock ccb = program_representation.resolve_function_call(fcall, scope_context.raw_scope_context);
     llvm::Function* llvm_function = callable_codeblocks_llvm_translator.translate_callable_code_block_to_llvm(ccb);
+    std::vector<TypeSignature> expected_arg_types = ccb.get_arg_types();
     std::vector<llvm::Value*> llvm_arguments;
     for (size_t arg_index = 0; arg_index < fcall.arguments.size(); arg_index++) {
         const Expression& concrete_arg = fcall.arguments[arg_index];
-        TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator);
+        TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
         TranslatedExpression translated_arg = translate_expression_to_llvm(block, concrete_arg);
         auto concrete_expr_type_opt = program_representation.resolve_expression_type(concrete_arg, scope_context.raw_scope_context);
         assert_type_deduction_success_in_backend_layer(concrete_expr_type_opt.has_value());
@@ -70,9 +78,19 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_expr_func
             block,
             translated_arg,
             concrete_expr_type,
-            ccb.get_arg_types()[arg_index]
+            expected_arg_types[arg_index]
         );
-        llvm_arguments.push_back(casted_arg.value);
+        llvm::IRBuilder<> arg_builder(block);
+        bool is_last_arg = arg_index + 1 == fcall.arguments.size();
+        if (!callable_codeblocks_llvm_translator.is_argument_passed_by_address(ccb, expected_arg_types[arg_index])) {
+            llvm_arguments.push_back(get_llvm_value(arg_builder, casted_arg));
+        }
+        else if (is_last_arg) {
+            llvm_arguments.push_back(get_llvm_address(arg_builder, frame_slots_allocator, casted_arg));
+        }
+        else {
+            llvm_arguments.push_back(create_aggregate_snapshot(arg_builder, frame_slots_allocator, casted_arg));
+        }
     }
     llvm::IRBuilder<> builder(block);
     return builder.CreateCall(llvm_function, llvm_arguments);
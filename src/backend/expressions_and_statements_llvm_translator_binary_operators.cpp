@@ -6,23 +6,24 @@
 #include "backend/expressions_and_statements_llvm_translator.hpp"
 #include "backend/callable_codeblocks_llvm_translator.hpp"
 #include "backend/type_manipulations_llvm_translator.hpp"
+#include "backend/llvm_wrappers.hpp"
 #include "errors/internal_errors.hpp"
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_is_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const TypeOperator& is_operator
 ) {
     TranslatedExpression union_expression = translate_expression_to_llvm(block, is_operator.expression);
-    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator);
+    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
     return type_operators_llvm_translator.test_concrete_type_of_union_in_llvm(block, union_expression, is_operator.typesignature);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_as_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const TypeOperator& as_operator
 ) {
     TranslatedExpression union_expression = translate_expression_to_llvm(block, as_operator.expression);
-    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator);
+    TypeManipulationsLLVMTranslator type_operators_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
     auto soruce_type_opt = program_representation.resolve_expression_type(as_operator.expression, scope_context.raw_scope_context);
     assert_type_deduction_success_in_backend_layer(soruce_type_opt.has_value());
     TypeSignature soruce_type = soruce_type_opt.value();
@@ -32,7 +33,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_as_operat
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_plus_binary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -45,7 +46,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_plus_bina
 } 
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_minus_binary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -58,7 +59,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_minus_bin
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_mul_binary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -71,7 +72,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_mul_binar
 }  
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_div_binary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -84,7 +85,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_div_binar
 }  
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_mod_binary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -97,27 +98,52 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_mod_binar
 }     
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_boolean_and_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
-    TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
-    TranslatedExpression right = translate_expression_to_llvm(block, binary_op.right_operand);
-    llvm::IRBuilder<> builder(block);
-    return builder.CreateAnd(left.value, right.value);
+    const bool short_circuit_outcome = false;
+    return translate_short_circuit_boolean_operator_to_llvm(block, binary_op, short_circuit_outcome);
 }   
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_boolean_or_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
-    TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
-    TranslatedExpression right = translate_expression_to_llvm(block, binary_op.right_operand);
-    llvm::IRBuilder<> builder(block);
-    return builder.CreateOr(left.value, right.value);
+    const bool short_circuit_outcome = true;
+    return translate_short_circuit_boolean_operator_to_llvm(block, binary_op, short_circuit_outcome);
 }   
 
+TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_short_circuit_boolean_operator_to_llvm(
+    llvm::BasicBlock*& block,
+    const BinaryOperator& binary_op,
+    bool short_circuit_outcome
+) {
+    std::string unique_operator_id = binary_op.as_debug_informations_aware_entity().unique_string_id();
+    TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
+    llvm::BasicBlock* left_exit_block = block;
+    auto rhs_block = createBlockAfter(context, binary_op.operator_text + ":rhs@" + unique_operator_id, left_exit_block);
+    auto exit_block = createBlockAfter(context, binary_op.operator_text + ":exit@" + unique_operator_id, rhs_block);
+    
+    llvm::BasicBlock* true_destination = (short_circuit_outcome) ? exit_block : rhs_block;
+    llvm::BasicBlock* false_destination = (short_circuit_outcome) ? rhs_block : exit_block;
+    llvm::IRBuilder<> left_builder(left_exit_block);
+    left_builder.CreateCondBr(left.value, true_destination, false_destination);
+
+    llvm::BasicBlock* right_exit_block = rhs_block;
+    TranslatedExpression right = translate_expression_to_llvm(right_exit_block, binary_op.right_operand);
+    llvm::IRBuilder<> right_builder(right_exit_block);
+    right_builder.CreateBr(exit_block);
+
+    llvm::IRBuilder<> exit_builder(exit_block);
+    llvm::PHINode* outcome = exit_builder.CreatePHI(llvm::Type::getInt1Ty(context), 2);
+    outcome->addIncoming(llvm::ConstantInt::getBool(context, short_circuit_outcome), left_exit_block);
+    outcome->addIncoming(right.value, right_exit_block);
+    block = exit_block;
+    return outcome;
+}
+
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_boolean_xor_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -8,7 +8,7 @@
 #include "errors/internal_errors.hpp"
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_LT_then_comparison_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -21,7 +21,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_LT_then_c
 }   
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_GT_comparison_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -34,7 +34,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_GT_compar
 }   
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_LE_comparison_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -47,7 +47,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_LE_compar
 }   
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_GE_comparison_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) { 
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -60,7 +60,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_GE_compar
 }   
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_EQ_comparison_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) {
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
@@ -73,7 +73,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_EQ_compar
 }   
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_NE_comparison_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& binary_op
 ) {
     TranslatedExpression left = translate_expression_to_llvm(block, binary_op.left_operand);
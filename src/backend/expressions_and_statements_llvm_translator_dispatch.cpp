@@ -26,7 +26,7 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_statement_to
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_expression_to_llvm(
-    llvm::BasicBlock* block, 
+    llvm::BasicBlock*& block, 
     const Expression& expression
 ) {
     switch (expression.expression_kind()) {
@@ -48,7 +48,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_expressio
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_type_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const TypeOperator& expr
 ) {
     switch (expr.operator_text.front()) {
@@ -59,7 +59,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_type_oper
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_unary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const UnaryOperator& expr
 ) {
     switch (expr.unary_op_kind) {
@@ -73,7 +73,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_unary_ope
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_binary_operator_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BinaryOperator& expr
 ) {
     switch (expr.binary_op_kind) {
@@ -9,7 +9,7 @@
 #include "errors/internal_errors.hpp"
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_member_access_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const DotMemberAccess& dot_member_access
 ) {    
     DotMemberAccess normalized = program_representation
@@ -40,23 +40,20 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_membe
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_member_access_on_custom_type_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const DotMemberAccess& dot_member_access_on_struct
 ) { 
     size_t field_index = program_representation
         .resolve_field_index(dot_member_access_on_struct, scope_context.raw_scope_context);
     TranslatedExpression target = translate_expression_to_llvm(block, dot_member_access_on_struct.struct_value);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* target_address = get_llvm_address(builder, target);
+    llvm::Value* target_address = get_llvm_address(builder, frame_slots_allocator, target);
     llvm::Value* field_address = builder.CreateStructGEP(target_address, field_index);
-    llvm::Value* field_value = builder.CreateLoad(field_address);
-    return (target.address == nullptr)
-        ? TranslatedExpression(field_value)
-        : TranslatedExpression(field_value, field_address);
+    return create_load_unless_aggregate(builder, field_address, target.address != nullptr);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_member_access_on_primitive_type_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const Expression& accessed_expression,
     const PrimitiveType primitive_type,
     const std::string& member_name
@@ -67,7 +64,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_membe
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_member_access_on_slice_type_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const Expression& accessed_expression,
     const SliceType& primitive_type,
     const std::string& member_name
@@ -77,12 +74,12 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_dot_membe
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_string_or_slice_length_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const Expression& expr
 ) {
     TranslatedExpression target = translate_expression_to_llvm(block, expr);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* target_address = get_llvm_address(builder, target);
+    llvm::Value* target_address = get_llvm_address(builder, frame_slots_allocator, target);
     llvm::Value* length_address = builder.CreateStructGEP(target_address, 0);
     llvm::Value* length_value = builder.CreateLoad(length_address);
     return (target.address == nullptr)
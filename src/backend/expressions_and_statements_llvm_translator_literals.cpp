@@ -9,80 +9,67 @@
 #include "errors/internal_errors.hpp"
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_boolean_literal_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const BoolLiteral& expr
 ) {
     return llvm::ConstantInt::get(llvm::Type::getInt1Ty(context), expr.value);   
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_character_literal_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const CharLiteral& expr
 ) {
     return llvm::ConstantInt::get(llvm::Type::getInt8Ty(context), expr.value);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_floating_literal_to_llvm(
-    llvm::BasicBlock* block, 
+    llvm::BasicBlock*& block, 
     const FloatLiteral& expr
 ) {
     return llvm::ConstantFP::get(llvm::Type::getDoubleTy(context), expr.value);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_integer_literal_to_llvm(
-    llvm::BasicBlock* block, 
+    llvm::BasicBlock*& block, 
     const IntLiteral& expr
 ) {
     return llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), expr.value);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_string_literal_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const StringLiteral& expr
 ) {
-    auto array_of_char_val = llvm::ConstantDataArray::getString(context, expr.value);
-    auto global_string_var = new llvm::GlobalVariable(
-        llvm_module,
-        array_of_char_val->getType(),
-        true,
-        llvm::GlobalValue::PrivateLinkage,
-        array_of_char_val,
-        expr.value
-    );
-    llvm::Type* char_ptr_type = type_definitions_llvm_translator.get_char_llvm_type()->getPointerTo();
     llvm::Type* string_type = type_definitions_llvm_translator.get_string_llvm_type();
-    auto ptr_to_first_char = llvm::ConstantExpr::getBitCast(global_string_var, char_ptr_type);
-    llvm::IRBuilder<> builder(block);
-    llvm::Value* string_address = builder.CreateAlloca(string_type);
-    llvm::Value* string_len_address = builder.CreateStructGEP(string_type, string_address, 0);
-    llvm::Value* string_data_address = builder.CreateStructGEP(string_type, string_address, 1);
-    llvm::Value* string_len = llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), expr.value.size());
-    builder.CreateStore(string_len, string_len_address);
-    builder.CreateStore(ptr_to_first_char, string_data_address);
-    llvm::Value* string_value = builder.CreateLoad(string_address);
-    return {string_value, string_address};
+    llvm::GlobalVariable* string_descriptor = literals_pool.intern_string_literal(expr.value, llvm::cast<llvm::StructType>(string_type));
+    return TranslatedExpression(nullptr, string_descriptor);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_identifier_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const Identifier& identifier
 ) {
-    llvm::AllocaInst* address = scope_context.resolve_object_allocation(identifier.name);
+    llvm::Value* address = scope_context.resolve_object_allocation(identifier.name);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* value = builder.CreateLoad(address);
-    return {value, address};
+    return create_load_unless_aggregate(builder, address);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_array_literal_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const ArrayLiteral& expr
 ) {
     const TypeSignature& stored_type = expr.stored_type;
     llvm::Type* llvm_stored_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(stored_type);
     llvm::ArrayType* llvm_array_type = llvm::ArrayType::get(llvm_stored_type, expr.elements.size());
     llvm::IRBuilder<> builder(block);
-    llvm::Value* llvm_array_address = builder.CreateAlloca(llvm_array_type);
-    TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator);
+    llvm::Value* llvm_array_address = frame_slots_allocator.allocate_frame_slot(llvm_array_type);
+    llvm::Constant* constant_array = translate_constant_array_literal_to_llvm(expr);
+    if (constant_array != nullptr) {
+        llvm::GlobalVariable* global_array = literals_pool.intern_constant_array(constant_array);
+        create_store_or_aggregate_copy(builder, TranslatedExpression(nullptr, global_array), llvm_array_address, false);
+        return create_load_unless_aggregate(builder, llvm_array_address);
+    }
+    TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
     for (size_t index = 0; index < expr.elements.size(); index++) {
         llvm::Value* element_index_as_expr = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), index);
         const Expression& element = expr.elements[index];
@@ -92,9 +79,54 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_array_lit
         TranslatedExpression array_element = translate_expression_to_llvm(block, element);
         TranslatedExpression casted_array_element = type_manipulations_llvm_translator
             .cast_translated_expression_to_another_type_in_llvm(block, array_element, element_type, stored_type);
+        builder.SetInsertPoint(block);
         llvm::Value* ptr_to_array_cell = create_array_gep(builder, llvm_array_address, element_index_as_expr);
-        builder.CreateStore(casted_array_element.value, ptr_to_array_cell);
+        create_store_or_aggregate_copy(builder, casted_array_element, ptr_to_array_cell, false);
+    }
+    return create_load_unless_aggregate(builder, llvm_array_address);
+}
+
+llvm::Constant* ExpressionsAndStatementsLLVMTranslator::translate_constant_array_literal_to_llvm(
+    const ArrayLiteral& expr
+) {
+    llvm::Type* llvm_stored_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(expr.stored_type);
+    std::vector<llvm::Constant*> constant_elements;
+    for (const Expression& element : expr.elements) {
+        llvm::Constant* constant_element = translate_expression_to_llvm_constant(element);
+        if (constant_element == nullptr || constant_element->getType() != llvm_stored_type) {
+            return nullptr;
+        }
+        constant_elements.push_back(constant_element);
+    }
+    llvm::ArrayType* llvm_array_type = llvm::ArrayType::get(llvm_stored_type, expr.elements.size());
+    return llvm::ConstantArray::get(llvm_array_type, constant_elements);
+}
+
+llvm::Constant* ExpressionsAndStatementsLLVMTranslator::translate_expression_to_llvm_constant(
+    const Expression& expr
+) {
+    switch (expr.expression_kind()) {
+        case ExpressionBody::Kind::int_literal:   return llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), expr.get<IntLiteral>().value);
+        case ExpressionBody::Kind::float_literal: return llvm::ConstantFP::get(llvm::Type::getDoubleTy(context), expr.get<FloatLiteral>().value);
+        case ExpressionBody::Kind::char_literal:  return llvm::ConstantInt::get(llvm::Type::getInt8Ty(context), expr.get<CharLiteral>().value);
+        case ExpressionBody::Kind::bool_literal:  return llvm::ConstantInt::get(llvm::Type::getInt1Ty(context), expr.get<BoolLiteral>().value);
+        case ExpressionBody::Kind::array_literal: return translate_constant_array_literal_to_llvm(expr.get<ArrayLiteral>());
+        case ExpressionBody::Kind::unary_operator: break;
+        default: return nullptr;
+    }
+    const UnaryOperator& unary_operator = expr.get<UnaryOperator>();
+    bool is_sign = unary_operator.unary_op_kind == UnaryOperator::Kind::minus_sign
+        || unary_operator.unary_op_kind == UnaryOperator::Kind::plus_sign;
+    bool is_numeric_literal = unary_operator.operand.expression_kind() == ExpressionBody::Kind::int_literal
+        || unary_operator.operand.expression_kind() == ExpressionBody::Kind::float_literal;
+    if (!is_sign || !is_numeric_literal) {
+        return nullptr;
+    }
+    llvm::Constant* operand = translate_expression_to_llvm_constant(unary_operator.operand);
+    if (unary_operator.unary_op_kind == UnaryOperator::Kind::plus_sign) {
+        return operand;
     }
-    llvm::Value* llvm_array_value = builder.CreateLoad(llvm_array_address);
-    return {llvm_array_value, llvm_array_address};
+    return (operand->getType()->isDoubleTy())
+        ? llvm::ConstantExpr::getFNeg(operand)
+        : llvm::ConstantExpr::getNeg(operand);
 }
\ No newline at end of file
@@ -13,11 +13,14 @@ static void translate_block_to_llvm_with_final_jump(
     llvm::BasicBlock* block, 
     const std::vector<Statement>& codeblock, 
     ExpressionsAndStatementsLLVMTranslator& translator,
+    FrameSlotsAllocator& frame_slots_allocator,
     llvm::BasicBlock* final_jump_block
 ) {
+    frame_slots_allocator.open_lifetime_scope();
     for (const Statement& statement : codeblock) {
         block = translator.translate_statement_to_llvm(block, statement);
     }
+    frame_slots_allocator.close_lifetime_scope();
     if (block->empty() || !block->getTerminator()) {
         llvm::IRBuilder<> builder(block);
         builder.CreateBr(final_jump_block);
@@ -47,15 +50,16 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_conditional_
     llvm::IRBuilder<> current_builder(current_block);
     current_builder.CreateBr(if_cond_block);
 
-    llvm::IRBuilder<> cond_builder(if_cond_block);
-    llvm::Value* condition = translate_expression_to_llvm(if_cond_block, conditional.condition).value;
+    llvm::BasicBlock* if_cond_exit_block = if_cond_block;
+    llvm::Value* condition = translate_expression_to_llvm(if_cond_exit_block, conditional.condition).value;
+    llvm::IRBuilder<> cond_builder(if_cond_exit_block);
     cond_builder.CreateCondBr(condition, if_then_block, if_else_block);
     
     auto then_translator = create_translator_for_nested_conditional();
-    translate_block_to_llvm_with_final_jump(if_then_block, conditional.then_branch, then_translator, if_exit_block);
+    translate_block_to_llvm_with_final_jump(if_then_block, conditional.then_branch, then_translator, frame_slots_allocator, if_exit_block);
 
     auto else_translator = create_translator_for_nested_conditional();
-    translate_block_to_llvm_with_final_jump(if_else_block, conditional.else_branch, else_translator, if_exit_block);
+    translate_block_to_llvm_with_final_jump(if_else_block, conditional.else_branch, else_translator, frame_slots_allocator, if_exit_block);
 
     return if_exit_block;
 }
@@ -72,12 +76,13 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_while_loop_t
     llvm::IRBuilder<> current_builder(current_block);
     current_builder.CreateBr(while_cond_block);
 
-    llvm::IRBuilder<> cond_builder(while_cond_block);
-    llvm::Value* condition = translate_expression_to_llvm(while_cond_block, while_loop.condition).value;
+    llvm::BasicBlock* while_cond_exit_block = while_cond_block;
+    llvm::Value* condition = translate_expression_to_llvm(while_cond_exit_block, while_loop.condition).value;
+    llvm::IRBuilder<> cond_builder(while_cond_exit_block);
     cond_builder.CreateCondBr(condition, while_body_block, while_exit_block);
 
     auto body_translator = create_translator_for_nested_loop(while_cond_block, while_exit_block);
-    translate_block_to_llvm_with_final_jump(while_body_block, while_loop.loop_body, body_translator, while_cond_block);
+    translate_block_to_llvm_with_final_jump(while_body_block, while_loop.loop_body, body_translator, frame_slots_allocator, while_cond_block);
 
     return while_exit_block;
 }
@@ -95,10 +100,11 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_until_loop_t
     current_builder.CreateBr(until_body_block);
 
     auto body_translator = create_translator_for_nested_loop(until_body_block, until_exit_block);
-    translate_block_to_llvm_with_final_jump(until_body_block, until_loop.loop_body, body_translator, until_cond_block);
+    translate_block_to_llvm_with_final_jump(until_body_block, until_loop.loop_body, body_translator, frame_slots_allocator, until_cond_block);
 
-    llvm::IRBuilder<> cond_builder(until_cond_block);
-    llvm::Value* condition = translate_expression_to_llvm(until_cond_block, until_loop.condition).value;
+    llvm::BasicBlock* until_cond_exit_block = until_cond_block;
+    llvm::Value* condition = translate_expression_to_llvm(until_cond_exit_block, until_loop.condition).value;
+    llvm::IRBuilder<> cond_builder(until_cond_exit_block);
     llvm::Value* negated_condition = cond_builder.CreateNot(condition);
     cond_builder.CreateCondBr(negated_condition, until_body_block, until_exit_block);
 
@@ -109,8 +115,7 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_return_state
     llvm::BasicBlock* block,
     const Return& return_statement
 ) {
-    TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator);
-    llvm::IRBuilder<> builder(block);
+    TypeManipulationsLLVMTranslator type_manipulations_llvm_translator(program_representation, type_definitions_llvm_translator, frame_slots_allocator);
     if (return_statement.return_value.has_value()) {
         const Expression& ret = return_statement.return_value.value();
         TranslatedExpression translated_ret = translate_expression_to_llvm(block, ret);
@@ -123,9 +128,11 @@ llvm::BasicBlock* ExpressionsAndStatementsLLVMTranslator::translate_return_state
             provided_ret_type,
             expected_return_type.value()
         );
-        builder.CreateRet(casted_ret_expr.value);
+        llvm::IRBuilder<> builder(block);
+        builder.CreateRet(get_llvm_value(builder, casted_ret_expr));
         return block;
     }   
+    llvm::IRBuilder<> builder(block);
     builder.CreateRetVoid();
     return block;
 }
@@ -10,7 +10,7 @@
 #include "syntax/primitive_types.hpp"
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_bracket_access_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const SquareBracketsAccess& expr
 ) {
     std::optional<TypeSignature> storage_type_opt = program_representation
@@ -30,14 +30,14 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_br
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_bracket_access_from_string_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const SquareBracketsAccess& expr
 ) {
     return translate_square_bracket_access_from_slice_to_llvm(block, expr);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_bracket_access_from_raw_string_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const SquareBracketsAccess& expr
 ) {
     TranslatedExpression ptr_to_first_char = translate_expression_to_llvm(block, expr.storage);
@@ -46,41 +46,34 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_br
     llvm::Value* index_value = index.value;
     std::vector<llvm::Value*> indices;
     llvm::Value* element_address = create_vector_gep(builder, ptr_to_first_char.value, index_value);
-    llvm::Value* element_value = builder.CreateLoad(element_address);
-    return TranslatedExpression(element_value, element_address);
+    return create_load_unless_aggregate(builder, element_address);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_bracket_access_from_array_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const SquareBracketsAccess& expr
 ) {
     TranslatedExpression storage = translate_expression_to_llvm(block, expr.storage);
     TranslatedExpression index = translate_expression_to_llvm(block, expr.index);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* storage_address = get_llvm_address(builder, storage);
+    llvm::Value* storage_address = get_llvm_address(builder, frame_slots_allocator, storage);
     llvm::Value* index_value = index.value;
     std::vector<llvm::Value*> indices;
     llvm::Value* element_address = create_array_gep(builder, storage_address, index_value);
-    llvm::Value* element_value = builder.CreateLoad(element_address);
-    return (storage.address == nullptr)
-        ? TranslatedExpression(element_value)
-        : TranslatedExpression(element_value, element_address);
+    return create_load_unless_aggregate(builder, element_address, storage.address != nullptr);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_square_bracket_access_from_slice_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const SquareBracketsAccess& expr
 ) {
     TranslatedExpression slice = translate_expression_to_llvm(block, expr.storage);
     TranslatedExpression index = translate_expression_to_llvm(block, expr.index);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* slice_address = get_llvm_address(builder, slice);
+    llvm::Value* slice_address = get_llvm_address(builder, frame_slots_allocator, slice);
     llvm::Value* index_value = index.value;
     llvm::Value* storage_address_address = builder.CreateStructGEP(slice_address, 1);
     llvm::Value* storage_address = builder.CreateLoad(storage_address_address);
     llvm::Value* element_address = builder.CreateGEP(storage_address, index_value);
-    llvm::Value* element_value = builder.CreateLoad(element_address);
-    return (slice.address == nullptr)
-        ? TranslatedExpression(element_value)
-        : TranslatedExpression(element_value, element_address);
+    return create_load_unless_aggregate(builder, element_address, slice.address != nullptr);
 }
\ No newline at end of file
@@ -6,10 +6,11 @@
 #include "backend/expressions_and_statements_llvm_translator.hpp"
 #include "backend/callable_codeblocks_llvm_translator.hpp"
 #include "backend/type_manipulations_llvm_translator.hpp"
+#include "backend/llvm_wrappers.hpp"
 #include "errors/internal_errors.hpp"
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_boolean_not_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const UnaryOperator& boolean_not
 ) {
     TranslatedExpression operand = translate_expression_to_llvm(block, boolean_not.operand);
@@ -19,7 +20,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_boolean_n
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_minus_sign_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const UnaryOperator& minus_sign
 ) {
     TranslatedExpression operand = translate_expression_to_llvm(block, minus_sign.operand);
@@ -35,7 +36,7 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_minus_sig
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_plus_sign_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const UnaryOperator& minus_sign
 ) {
     TranslatedExpression operand = translate_expression_to_llvm(block, minus_sign.operand);
@@ -43,19 +44,16 @@ TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_plus_sign
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_ptr_dereference_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const UnaryOperator& minus_sign
 ) {
     TranslatedExpression operand = translate_expression_to_llvm(block, minus_sign.operand);
     llvm::IRBuilder<> builder(block);
-    return TranslatedExpression(
-        builder.CreateLoad(operand.value), 
-        operand.value
-    );  
+    return create_load_unless_aggregate(builder, operand.value);
 }
 
 TranslatedExpression ExpressionsAndStatementsLLVMTranslator::translate_addressof_to_llvm(
-    llvm::BasicBlock* block,
+    llvm::BasicBlock*& block,
     const UnaryOperator& minus_sign
 ) {
     TranslatedExpression operand = translate_expression_to_llvm(block, minus_sign.operand);
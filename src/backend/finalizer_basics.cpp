@@ -4,18 +4,57 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include <iostream>
+#include <algorithm>
 
 #include "backend/finalizer.hpp"
 #include "errors/commandline_errors.hpp"
 
+static std::string resolve_target_cpu(const std::optional<std::string>& target_cpu) {
+    if (!target_cpu.has_value()) {
+        return "";
+    }
+    return (target_cpu.value() == "native")
+        ? llvm::sys::getHostCPUName().str()
+        : target_cpu.value();
+}
+
+static std::string resolve_target_features(
+    const std::optional<std::string>& target_cpu,
+    const std::optional<std::string>& target_features
+) {
+    std::vector<std::string> features;
+    llvm::StringMap<bool> host_features;
+    if (target_cpu == "native" && llvm::sys::getHostCPUFeatures(host_features)) {
+        for (const auto& host_feature : host_features) {
+            std::string sign = (host_feature.getValue()) ? "+" : "-";
+            features.push_back(sign + host_feature.getKey().str());
+        }
+        std::sort(features.begin(), features.end());
+    }
+    if (target_features.has_value() && !target_features.value().empty()) {
+        features.push_back(target_features.value());
+    }
+    std::string resolved_features;
+    for (const std::string& feature : features) {
+        resolved_features += (resolved_features.empty()) ? feature : "," + feature;
+    }
+    return resolved_features;
+}
+
 Finalizer::Finalizer(
     ProgramRepresentation& input_program_representation,
-    std::optional<std::string> target_triple
+    std::optional<std::string> target_triple,
+    std::optional<std::string> target_cpu,
+    std::optional<std::string> target_features,
+    OptimizationLevel optimization_level
 ) : Finalizer(
         input_program_representation, 
         target_triple.has_value()
             ? target_triple.value() 
-            : llvm::sys::getDefaultTargetTriple()
+            : llvm::sys::getDefaultTargetTriple(),
+        resolve_target_cpu(target_cpu),
+        resolve_target_features(target_cpu, target_features),
+        optimization_level
     )
 {}
 
@@ -28,22 +67,30 @@ Finalizer::Finalizer(ProgramRepresentation& program_representation)
 
 Finalizer::Finalizer(
     ProgramRepresentation& input_program_representation,
-    const std::string& target_triple
+    const std::string& target_triple,
+    const std::string& target_cpu,
+    const std::string& target_features,
+    OptimizationLevel optimization_level
 ) 
     : program_representation(input_program_representation)
     , target_triple(target_triple)
-    , llvm_context()
-    , llvm_module("basalt_program", llvm_context)
+    , target_cpu(target_cpu)
+    , target_features(target_features)
+    , optimization_level(optimization_level)
+    , llvm_context(std::make_unique<llvm::LLVMContext>())
+    , llvm_module(std::make_unique<llvm::Module>("basalt_program", *llvm_context))
     , type_definitions_llvm_translator(
         program_representation, 
-        llvm_context, 
-        llvm_module
+        *llvm_context, 
+        *llvm_module
     )
+    , literals_pool(*llvm_context, *llvm_module)
     , callable_codeblocks_llvm_translator(
         program_representation, 
         type_definitions_llvm_translator, 
-        llvm_context, 
-        llvm_module
+        literals_pool,
+        *llvm_context, 
+        *llvm_module
     )
 {
     llvm::InitializeAllTargetInfos();
@@ -54,13 +101,21 @@ Finalizer::Finalizer(
     std::string error;
     const llvm::Target* target(llvm::TargetRegistry::lookupTarget(target_triple, error));
     ensure_valid_target_triple(target_triple, error);
+    if (!target_cpu.empty()) {
+        std::unique_ptr<llvm::MCSubtargetInfo> subtarget_info(
+            target->createMCSubtargetInfo(target_triple, "", "")
+        );
+        ensure_valid_target_cpu(target_cpu, target_triple, subtarget_info->isCPUStringValid(target_cpu));
+    }
 
     llvm_target_machine = target->createTargetMachine(
         target_triple,
-        "generic", 
-        "",
+        target_cpu, 
+        target_features,
         llvm::TargetOptions(), 
-        llvm::Optional<llvm::Reloc::Model>()
+        llvm::Optional<llvm::Reloc::Model>(llvm::Reloc::PIC_),
+        llvm::Optional<llvm::CodeModel::Model>(),
+        get_llvm_codegen_optimization_level()
     );
-    llvm_module.setDataLayout(llvm_target_machine->createDataLayout());
+    llvm_module->setDataLayout(llvm_target_machine->createDataLayout());
 }
\ No newline at end of file
@@ -8,9 +8,11 @@
 #include "backend/finalizer.hpp"
 #include "backend/type_definitions_llvm_translator.hpp"
 #include "backend/callable_codeblocks_llvm_translator.hpp"
+#include "misc/compilation_statistics.hpp"
 
 void Finalizer::generate_llvm_ir() {
     std::cout << "Generating LLVM IR..." << std::endl;
+    ScopedPhaseTimer phase_timer("Finalizer::generate_llvm_ir");
     program_representation.foreach_function_definition(
         [&](const FunctionDefinition::Ref& function_definition) {
             if (function_definition->template_generics_names.empty()) {
@@ -19,18 +21,35 @@ void Finalizer::generate_llvm_ir() {
             }
         }
     );
+    apply_target_attributes_to_llvm_functions();
+}
+
+void Finalizer::apply_target_attributes_to_llvm_functions() {
+    for (llvm::Function& llvm_function : *llvm_module) {
+        if (llvm_function.isDeclaration()) {
+            continue;
+        }
+        if (!target_cpu.empty()) {
+            llvm_function.addFnAttr("target-cpu", target_cpu);
+        }
+        if (!target_features.empty()) {
+            llvm_function.addFnAttr("target-features", target_features);
+        }
+    }
 }
 
 void Finalizer::emit_llvm_ir(const std::string& output_file_name) {
     std::cout << "Emitting LLVM..." << std::endl;
+    ScopedPhaseTimer phase_timer("Finalizer::emit_llvm_ir", output_file_name);
 	std::error_code error_code;
 	llvm::raw_fd_ostream output_file (output_file_name, error_code);
-	llvm_module.print(output_file, nullptr);
-	llvm_module.print(llvm::outs(), nullptr);
+	llvm_module->print(output_file, nullptr);
+	llvm_module->print(llvm::outs(), nullptr);
 }
 
 void Finalizer::emit_object_file(const std::string& output_file_name) {
     std::cout << "Emitting Object File..." << std::endl;
+    ScopedPhaseTimer phase_timer("Finalizer::emit_object_file", output_file_name);
     std::error_code error_code;
     llvm::raw_fd_ostream output_file(
         output_file_name, 
@@ -41,14 +60,15 @@ void Finalizer::emit_object_file(const std::string& output_file_name) {
     llvm::legacy::PassManager pass_manager;
     auto file_type = llvm::CodeGenFileType::CGFT_ObjectFile;
     llvm_target_machine->addPassesToEmitFile(pass_manager, output_file, nullptr, file_type);    
-    pass_manager.run(llvm_module);
+    pass_manager.run(*llvm_module);
 
     std::cout << "Result: " << output_file_name << std::endl;
-    std::cout << "(target: " << target_triple << ")" << std::endl;
+    std::cout << "(target: " << target_triple << ", cpu: " << (target_cpu.empty() ? "default" : target_cpu) << ")" << std::endl;
 }
 
 void Finalizer::emit_assembly_file(const std::string& output_file_name) {
     std::cout << "Emitting Assembly File..." << std::endl;
+    ScopedPhaseTimer phase_timer("Finalizer::emit_assembly_file", output_file_name);
     std::error_code error_code;
     llvm::raw_fd_ostream output_file(
         output_file_name, 
@@ -59,8 +79,8 @@ void Finalizer::emit_assembly_file(const std::string& output_file_name) {
     llvm::legacy::PassManager pass_manager;
     auto file_type = llvm::CodeGenFileType::CGFT_AssemblyFile;
     llvm_target_machine->addPassesToEmitFile(pass_manager, output_file, nullptr, file_type);
-    pass_manager.run(llvm_module);
+    pass_manager.run(*llvm_module);
 
     std::cout << "Result: " << output_file_name << std::endl;
-    std::cout << "(target: " << target_triple << ")" << std::endl;
+    std::cout << "(target: " << target_triple << ", cpu: " << (target_cpu.empty() ? "default" : target_cpu) << ")" << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <iostream>
+#include <iomanip>
+
+#include "backend/finalizer.hpp"
+#include "errors/internal_errors.hpp"
+#include "errors/commandline_errors.hpp"
+
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/MC/SubtargetFeature.h>
+#include <llvm/IR/IRBuilder.h>
+
+static std::chrono::steady_clock::time_point jit_startup_instant;
+static std::string jit_target_description;
+static bool jit_startup_latency_reported = false;
+
+static void report_jit_startup_latency() {
+    if (jit_startup_latency_reported) {
+        return;
+    }
+    jit_startup_latency_reported = true;
+    auto startup_latency = std::chrono::steady_clock::now() - jit_startup_instant;
+    double startup_latency_in_milliseconds = std::chrono::duration<double, std::milli>(startup_latency).count();
+    std::cerr << "Startup latency: " << std::fixed << std::setprecision(3) << startup_latency_in_milliseconds << " ms" << std::endl;
+    std::cerr << jit_target_description << std::endl;
+}
+
+static void insert_startup_latency_probe(llvm::Function& main_function, const std::string& probe_name) {
+    llvm::LLVMContext& context = main_function.getContext();
+    llvm::FunctionCallee startup_latency_probe = main_function.getParent()->getOrInsertFunction(
+        probe_name, 
+        llvm::FunctionType::get(llvm::Type::getVoidTy(context), false)
+    );
+    llvm::BasicBlock& entry_block = main_function.getEntryBlock();
+    llvm::IRBuilder<> builder(&entry_block, entry_block.getFirstInsertionPt());
+    builder.CreateCall(startup_latency_probe);
+}
+
+int Finalizer::execute_llvm_ir_just_in_time(std::chrono::steady_clock::time_point startup_instant) {
+    std::cerr << "Starting JIT..." << std::endl;
+    llvm::Function* main_function = llvm_module->getFunction("main");
+    ensure_main_function_is_defined_for_jit_execution(main_function != nullptr && !main_function->isDeclaration());
+    bool main_function_returns_void = main_function->getReturnType()->isVoidTy();
+    const std::string startup_latency_probe_name = "basalt.jit.startup_latency_probe";
+    insert_startup_latency_probe(*main_function, startup_latency_probe_name);
+    jit_startup_instant = startup_instant;
+    jit_target_description = "(target: " + target_triple + ", cpu: " + target_cpu + ")";
+
+    llvm::orc::JITTargetMachineBuilder target_machine_builder { llvm::Triple(target_triple) };
+    target_machine_builder.setCPU(target_cpu);
+    target_machine_builder.addFeatures(llvm::SubtargetFeatures(target_features).getFeatures());
+    target_machine_builder.setCodeGenOptLevel(get_llvm_codegen_optimization_level());
+
+    auto lazy_jit_creation_outcome = llvm::orc::LLLazyJITBuilder()
+        .setJITTargetMachineBuilder(std::move(target_machine_builder))
+        .create();
+    assert_llvm_jit_operation_succeeded(lazy_jit_creation_outcome.takeError());
+    std::unique_ptr<llvm::orc::LLLazyJIT> lazy_jit = std::move(*lazy_jit_creation_outcome);
+
+    auto host_process_symbols = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        lazy_jit->getDataLayout().getGlobalPrefix()
+    );
+    assert_llvm_jit_operation_succeeded(host_process_symbols.takeError());
+    lazy_jit->getMainJITDylib().addGenerator(std::move(*host_process_symbols));
+
+    llvm::orc::SymbolMap startup_latency_probe_symbol;
+    startup_latency_probe_symbol[lazy_jit->mangleAndIntern(startup_latency_probe_name)] = llvm::JITEvaluatedSymbol(
+        llvm::pointerToJITTargetAddress(&report_jit_startup_latency), 
+        llvm::JITSymbolFlags::Exported
+    );
+    assert_llvm_jit_operation_succeeded(
+        lazy_jit->getMainJITDylib().define(llvm::orc::absoluteSymbols(std::move(startup_latency_probe_symbol)))
+    );
+
+    llvm_module->setDataLayout(lazy_jit->getDataLayout());
+    llvm::orc::ThreadSafeModule thread_safe_module(std::move(llvm_module), std::move(llvm_context));
+    assert_llvm_jit_operation_succeeded(lazy_jit->addLazyIRModule(std::move(thread_safe_module)));
+
+    auto main_function_lookup_outcome = lazy_jit->lookup("main");
+    assert_llvm_jit_operation_succeeded(main_function_lookup_outcome.takeError());
+    llvm::JITTargetAddress main_function_address = main_function_lookup_outcome->getAddress();
+
+    if (main_function_returns_void) {
+        auto jit_compiled_main = reinterpret_cast<void(*)()>(main_function_address);
+        jit_compiled_main();
+        return EXIT_SUCCESS;
+    }
+    auto jit_compiled_main = reinterpret_cast<int64_t(*)()>(main_function_address);
+    return static_cast<int>(jit_compiled_main());
+}
\ No newline at end of file
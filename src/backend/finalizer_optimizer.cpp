@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <iostream>
+
+#include "backend/finalizer.hpp"
+#include "errors/internal_errors.hpp"
+#include "misc/compilation_statistics.hpp"
+
+#include <llvm/Transforms/IPO/GlobalDCE.h>
+
+void Finalizer::optimize_llvm_ir() {
+    if (optimization_level != OptimizationLevel::O0) {
+        std::cout << "Optimizing LLVM IR..." << std::endl;
+    }
+    ScopedPhaseTimer phase_timer("Finalizer::optimize_llvm_ir");
+    assert_llvm_module_is_well_formed(*llvm_module);
+
+    llvm::LoopAnalysisManager loop_analysis_manager;
+    llvm::FunctionAnalysisManager function_analysis_manager;
+    llvm::CGSCCAnalysisManager cgscc_analysis_manager;
+    llvm::ModuleAnalysisManager module_analysis_manager;
+    
+    llvm::PassBuilder pass_builder(llvm_target_machine);
+    pass_builder.registerModuleAnalyses(module_analysis_manager);
+    pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+    pass_builder.registerFunctionAnalyses(function_analysis_manager);
+    pass_builder.registerLoopAnalyses(loop_analysis_manager);
+    pass_builder.crossRegisterProxies(
+        loop_analysis_manager, 
+        function_analysis_manager, 
+        cgscc_analysis_manager, 
+        module_analysis_manager
+    );
+
+    llvm::ModulePassManager module_pass_manager;
+    if (optimization_level == OptimizationLevel::O0) {
+        module_pass_manager.addPass(llvm::GlobalDCEPass());
+    }
+    else {
+        module_pass_manager = pass_builder.buildPerModuleDefaultPipeline(get_llvm_optimization_level());
+    }
+    module_pass_manager.run(*llvm_module, module_analysis_manager);
+}
+
+llvm::PassBuilder::OptimizationLevel Finalizer::get_llvm_optimization_level() const {
+    switch (optimization_level) {
+        case OptimizationLevel::O0: return llvm::PassBuilder::OptimizationLevel::O0;
+        case OptimizationLevel::O1: return llvm::PassBuilder::OptimizationLevel::O1;
+        case OptimizationLevel::O2: return llvm::PassBuilder::OptimizationLevel::O2;
+        case OptimizationLevel::O3: return llvm::PassBuilder::OptimizationLevel::O3;
+        case OptimizationLevel::Os: return llvm::PassBuilder::OptimizationLevel::Os;
+    }
+    assert_unreachable();
+}
+
+llvm::CodeGenOpt::Level Finalizer::get_llvm_codegen_optimization_level() const {
+    switch (optimization_level) {
+        case OptimizationLevel::O0: return llvm::CodeGenOpt::None;
+        case OptimizationLevel::O1: return llvm::CodeGenOpt::Less;
+        case OptimizationLevel::O2: return llvm::CodeGenOpt::Default;
+        case OptimizationLevel::O3: return llvm::CodeGenOpt::Aggressive;
+        case OptimizationLevel::Os: return llvm::CodeGenOpt::Default;
+    }
+    assert_unreachable();
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "backend/frame_slots_allocator.hpp"
+#include "errors/internal_errors.hpp"
+
+FrameSlotsAllocator::FrameSlotsAllocator(llvm::BasicBlock* entry_block)
+    : entry_block(entry_block)
+{
+    open_lifetime_scope();
+}
+
+llvm::AllocaInst* FrameSlotsAllocator::allocate_frame_slot(llvm::Type* slot_type) {
+    assert(!lifetime_scopes.empty());
+    std::vector<llvm::AllocaInst*>& free_slots_of_same_type = free_frame_slots[slot_type];
+    llvm::AllocaInst* frame_slot = nullptr;
+    if (!free_slots_of_same_type.empty()) {
+        frame_slot = free_slots_of_same_type.back();
+        free_slots_of_same_type.pop_back();
+    }
+    else {
+        llvm::BasicBlock::iterator insertion_point = entry_block->begin();
+        while (insertion_point != entry_block->end() && llvm::isa<llvm::AllocaInst>(*insertion_point)) {
+            insertion_point++;
+        }
+        llvm::IRBuilder<> entry_builder(entry_block, insertion_point);
+        frame_slot = entry_builder.CreateAlloca(slot_type, nullptr);
+    }
+    lifetime_scopes.back().push_back(frame_slot);
+    return frame_slot;
+}
+
+void FrameSlotsAllocator::open_lifetime_scope() {
+    lifetime_scopes.emplace_back();
+}
+
+void FrameSlotsAllocator::close_lifetime_scope() {
+    assert(lifetime_scopes.size() > 1);
+    for (llvm::AllocaInst* frame_slot : lifetime_scopes.back()) {
+        free_frame_slots[frame_slot->getAllocatedType()].push_back(frame_slot);
+    }
+    lifetime_scopes.pop_back();
+}
\ No newline at end of file
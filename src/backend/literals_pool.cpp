@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "backend/literals_pool.hpp"
+
+LiteralsPool::LiteralsPool(llvm::LLVMContext& llvm_context, llvm::Module& llvm_module)
+    : llvm_context(llvm_context)
+    , llvm_module(llvm_module)
+{ }
+
+llvm::GlobalVariable* LiteralsPool::intern_constant_array(llvm::Constant* constant_array) {
+    auto search_outcome = constant_arrays.find(constant_array);
+    if (search_outcome != constant_arrays.end()) {
+        return search_outcome->second;
+    }
+    auto global_array = new llvm::GlobalVariable(
+        llvm_module,
+        constant_array->getType(),
+        true,
+        llvm::GlobalValue::PrivateLinkage,
+        constant_array,
+        "constant_array"
+    );
+    global_array->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+    constant_arrays.insert({constant_array, global_array});
+    return global_array;
+}
+
+llvm::GlobalVariable* LiteralsPool::intern_string_literal(const std::string& text, llvm::StructType* string_type) {
+    auto search_outcome = string_literals.find(text);
+    if (search_outcome != string_literals.end()) {
+        return search_outcome->second;
+    }
+    llvm::Constant* array_of_char = llvm::ConstantDataArray::getString(llvm_context, text);
+    auto global_chars = new llvm::GlobalVariable(
+        llvm_module,
+        array_of_char->getType(),
+        true,
+        llvm::GlobalValue::PrivateLinkage,
+        array_of_char,
+        "string_literal_chars"
+    );
+    global_chars->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+    llvm::Type* char_ptr_type = string_type->getElementType(1);
+    llvm::Constant* string_descriptor = llvm::ConstantStruct::get(string_type, {
+        llvm::ConstantInt::get(llvm::Type::getInt64Ty(llvm_context), text.size()),
+        llvm::ConstantExpr::getBitCast(global_chars, char_ptr_type)
+    });
+    auto global_string = new llvm::GlobalVariable(
+        llvm_module,
+        string_type,
+        true,
+        llvm::GlobalValue::PrivateLinkage,
+        string_descriptor,
+        "string_literal"
+    );
+    global_string->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+    string_literals.insert({text, global_string});
+    return global_string;
+}
\ No newline at end of file
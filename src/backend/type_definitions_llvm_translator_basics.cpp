@@ -16,17 +16,18 @@ TypeDefinitionsLLVMTranslator::TypeDefinitionsLLVMTranslator(
     , context(context)
     , llvm_module(llvm_module)
 { 
-    llvm_type_definitions.insert({int_type, llvm::Type::getInt64Ty(context)});
-    llvm_type_definitions.insert({float_type, llvm::Type::getDoubleTy(context)});
-    llvm_type_definitions.insert({bool_type, llvm::Type::getInt1Ty(context)});
-    llvm_type_definitions.insert({char_type, llvm::Type::getInt8Ty(context)});
-    llvm_type_definitions.insert({raw_string_type, llvm::Type::getInt8Ty(context)->getPointerTo()});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(int_type), llvm::Type::getInt64Ty(context)});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(int32_type), llvm::Type::getInt32Ty(context)});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(float_type), llvm::Type::getDoubleTy(context)});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(bool_type), llvm::Type::getInt1Ty(context)});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(char_type), llvm::Type::getInt8Ty(context)});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(raw_string_type), llvm::Type::getInt8Ty(context)->getPointerTo()});
     llvm::Type* string_internal_representation[] = {
-        llvm_type_definitions[int_type],
-        llvm_type_definitions[raw_string_type],
+        get_int_llvm_type(),
+        get_raw_string_llvm_type(),
     };
     llvm::Type* llvm_string_type = llvm::StructType::create(context, string_internal_representation, string_type);
-    llvm_type_definitions.insert({string_type, llvm_string_type});
+    llvm_type_definitions.insert({program_representation.get_fully_qualified_name_id(string_type), llvm_string_type});
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_typesignature_to_llvm_type(
@@ -65,25 +66,25 @@ llvm::Type* TypeDefinitionsLLVMTranslator::translate_return_type_to_llvm_type(
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::get_int_llvm_type() {
-    return llvm_type_definitions[int_type];
+    return llvm_type_definitions.at(program_representation.get_fully_qualified_name_id(int_type));
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::get_float_llvm_type() {
-    return llvm_type_definitions[float_type];
+    return llvm_type_definitions.at(program_representation.get_fully_qualified_name_id(float_type));
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::get_char_llvm_type() {
-    return llvm_type_definitions[char_type];
+    return llvm_type_definitions.at(program_representation.get_fully_qualified_name_id(char_type));
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::get_bool_llvm_type() {
-    return llvm_type_definitions[bool_type];
+    return llvm_type_definitions.at(program_representation.get_fully_qualified_name_id(bool_type));
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::get_string_llvm_type() {
-    return llvm_type_definitions[string_type];
+    return llvm_type_definitions.at(program_representation.get_fully_qualified_name_id(string_type));
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::get_raw_string_llvm_type() {
-    return llvm_type_definitions[raw_string_type];
+    return llvm_type_definitions.at(program_representation.get_fully_qualified_name_id(raw_string_type));
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "backend/type_definitions_llvm_translator.hpp"
+#include "errors/internal_errors.hpp"
+
+#include <algorithm>
+
+llvm::IntegerType* TypeDefinitionsLLVMTranslator::get_type_tag_llvm_type() {
+    return llvm::Type::getInt64Ty(context);
+}
+
+llvm::ConstantInt* TypeDefinitionsLLVMTranslator::fetch_type_tag(
+    const TypeSignature& type_signature
+) {
+    const TypeId type_signature_id = program_representation.get_typesignature_id(type_signature);
+    auto search_outcome = llvm_type_tags.find(type_signature_id);
+    if (search_outcome != llvm_type_tags.end()) {
+        return search_outcome->second;
+    }
+    const uint64_t next_available_type_tag = llvm_type_tags.size() + 1;
+    llvm::ConstantInt* type_tag = llvm::ConstantInt::get(get_type_tag_llvm_type(), next_available_type_tag);
+    llvm_type_tags.insert({type_signature_id, type_tag});
+    return type_tag;
+}
+
+std::vector<llvm::ConstantInt*> 
+TypeDefinitionsLLVMTranslator::fetch_all_type_tags_for_non_union_compatible_types(
+    const TypeSignature& type_signature
+) {
+    const TypeId type_signature_id = program_representation.get_typesignature_id(type_signature);
+    auto search_outcome = llvm_compatible_type_tags.find(type_signature_id);
+    if (search_outcome != llvm_compatible_type_tags.end()) {
+        return search_outcome->second;
+    }
+    const std::vector<TypeSignature>& compatible_types = program_representation
+        .fetch_non_union_compatible_types_for_union_assignment(type_signature);
+    std::vector<llvm::ConstantInt*> compatible_type_tags;
+    for (const TypeSignature& compatible_type : compatible_types) {
+        llvm::ConstantInt* compatible_type_tag = fetch_type_tag(compatible_type);
+        compatible_type_tags.push_back(compatible_type_tag);
+    }
+    llvm_compatible_type_tags.insert({type_signature_id, compatible_type_tags});
+    return compatible_type_tags;
+}
+
+std::vector<llvm::ConstantInt*> 
+TypeDefinitionsLLVMTranslator::fetch_all_type_tags_matching_type(
+    const TypeSignature& type_signature
+) {
+    if (!program_representation.is_union(type_signature)) {
+        return { fetch_type_tag(type_signature) };
+    }
+    std::vector<llvm::ConstantInt*> matching_type_tags = 
+        fetch_all_type_tags_for_non_union_compatible_types(type_signature);
+    std::sort(matching_type_tags.begin(), matching_type_tags.end(), 
+        [](llvm::ConstantInt* left, llvm::ConstantInt* right) { 
+            return left->getZExtValue() < right->getZExtValue(); 
+        }
+    );
+    auto duplicates_begin = std::unique(matching_type_tags.begin(), matching_type_tags.end());
+    matching_type_tags.erase(duplicates_begin, matching_type_tags.end());
+    return matching_type_tags;
+}
+
+void TypeDefinitionsLLVMTranslator::assign_contiguous_type_tags_to_union_alternatives(
+    const std::vector<TypeSignature>& alternatives
+) {
+    for (const TypeSignature& alternative : alternatives) {
+        std::ignore = fetch_all_type_tags_matching_type(alternative);
+    }
+}
\ No newline at end of file
@@ -9,17 +9,29 @@
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_custom_type_to_llvm_type(
     const CustomType& custom_type
 ) {
+    const TypeId custom_type_id = program_representation.get_typesignature_id(custom_type);
+    auto search_outcome = llvm_custom_types.find(custom_type_id);
+    if (search_outcome != llvm_custom_types.end()) {
+        return search_outcome->second;
+    }
+    llvm::Type* llvm_custom_type = nullptr;
     TypeSignature unaliased_type = program_representation.unalias_type(custom_type);
     if (unaliased_type.typesiganture_kind() != TypeSignatureBody::Kind::custom_type) {
-        return translate_typesignature_to_llvm_type(unaliased_type);
+        llvm_custom_type = translate_typesignature_to_llvm_type(unaliased_type);
     }
-    const CustomType& unaliased_customtype = unaliased_type.get<CustomType>();
-    TypeDefinition type_definition = program_representation.retrieve_type_definition(unaliased_customtype);
-    if (type_definition.is<StructDefinition>()) {
-        return translate_struct_to_llvm_type(type_definition.get<StructDefinition>());
+    else {
+        const CustomType& unaliased_customtype = unaliased_type.get<CustomType>();
+        TypeDefinition type_definition = program_representation.retrieve_type_definition(unaliased_customtype);
+        if (type_definition.is<StructDefinition>()) {
+            llvm_custom_type = translate_struct_to_llvm_type(type_definition.get<StructDefinition>());
+        }
+        else {
+            assert_typedefinition_is<UnionDefinition>(type_definition);
+            llvm_custom_type = translate_named_union_to_llvm_type(type_definition.get<UnionDefinition>());
+        }
     }
-    assert_typedefinition_is<UnionDefinition>(type_definition);
-    return translate_named_union_to_llvm_type(type_definition.get<UnionDefinition>());
+    llvm_custom_types.insert({custom_type_id, llvm_custom_type});
+    return llvm_custom_type;
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_pointer_type_to_llvm_type(
@@ -33,8 +45,8 @@ llvm::Type* TypeDefinitionsLLVMTranslator::translate_pointer_type_to_llvm_type(
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_primitive_type_to_llvm(
     const PrimitiveType& primitive_type
 ) {
-    const std::string primitive_type_name = primitive_type.type_name;
-    llvm::Type* primitive_llvm_type = llvm_type_definitions.at(primitive_type_name);
+    const TypeId primitive_type_id = program_representation.get_fully_qualified_name_id(primitive_type.type_name);
+    llvm::Type* primitive_llvm_type = llvm_type_definitions.at(primitive_type_id);
     return primitive_llvm_type;
 }
 
@@ -50,43 +62,45 @@ llvm::Type* TypeDefinitionsLLVMTranslator::translate_array_type_to_llvm_type(
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_slice_type_to_llvm_type(
     const SliceType& slice_type
 ) {
-    const std::string fully_qualified_name = program_representation.get_fully_qualified_typesignature_name(slice_type);
-    auto search_outcome = llvm_type_definitions.find(fully_qualified_name);
+    const TypeId slice_type_id = program_representation.get_typesignature_id(slice_type);
+    auto search_outcome = llvm_type_definitions.find(slice_type_id);
     if (search_outcome != llvm_type_definitions.end()) {
         return search_outcome->second;
     }
     const TypeSignature& stored_type = slice_type.stored_type;
     llvm::Type* llvm_stored_type = translate_typesignature_to_llvm_type(stored_type);
+    const std::string& fully_qualified_name = program_representation.get_fully_qualified_name(slice_type_id);
     llvm::StructType* llvm_slice_representation = llvm::StructType::create(context, fully_qualified_name);
     llvm_slice_representation->setBody({ llvm::Type::getInt64Ty(context), llvm_stored_type->getPointerTo() });
-    llvm_type_definitions.insert({fully_qualified_name, llvm_slice_representation});
+    llvm_type_definitions.insert({slice_type_id, llvm_slice_representation});
     return llvm_slice_representation;
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_inline_union_to_llvm_type(
     const InlineUnion& inline_union
 ) {
-    const std::string fully_qualified_name = program_representation.get_fully_qualified_typesignature_name(inline_union);
-    return translate_union_to_llvm_type(inline_union.alternatives, fully_qualified_name);
+    const TypeId inline_union_type_id = program_representation.get_typesignature_id(inline_union);
+    return translate_union_to_llvm_type(inline_union.alternatives, inline_union_type_id);
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_named_union_to_llvm_type(
     const UnionDefinition& union_definition
 ) {
-    const std::string fully_qualified_name = program_representation.get_fully_qualified_typedefinition_name(union_definition);
-    return translate_union_to_llvm_type(union_definition.types, fully_qualified_name);
+    const TypeId union_definition_type_id = program_representation.get_typedefinition_id(union_definition);
+    return translate_union_to_llvm_type(union_definition.types, union_definition_type_id);
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_union_to_llvm_type(
     const std::vector<TypeSignature>& alternatives,
-    const std::string& fully_qualified_name
+    TypeId union_type_id
 ) {
-    auto search_outcome = llvm_type_definitions.find(fully_qualified_name);
+    auto search_outcome = llvm_type_definitions.find(union_type_id);
     if (search_outcome != llvm_type_definitions.end()) {
         return search_outcome->second;
     }
+    const std::string& fully_qualified_name = program_representation.get_fully_qualified_name(union_type_id);
     llvm::StructType* llvm_type_def = llvm::StructType::create(context, fully_qualified_name);
-    llvm_type_definitions.insert({fully_qualified_name, llvm_type_def});
+    llvm_type_definitions.insert({union_type_id, llvm_type_def});
     size_t union_payload_memory_size_in_bytes = 0;
     for (const TypeSignature& alternative : alternatives) {
         union_payload_memory_size_in_bytes = std::max(
@@ -95,21 +109,23 @@ llvm::Type* TypeDefinitionsLLVMTranslator::translate_union_to_llvm_type(
         );
     }
     llvm::Type* union_payload = llvm::ArrayType::get(llvm::Type::getInt8Ty(context), union_payload_memory_size_in_bytes);
-    llvm::Type* union_header = llvm::Type::getInt8Ty(context)->getPointerTo();
+    llvm::Type* union_header = get_type_tag_llvm_type();
     llvm_type_def->setBody({ union_header, union_payload });
-    llvm_type_definitions.insert({fully_qualified_name, llvm_type_def});
-    return llvm_type_definitions.at(fully_qualified_name);
+    assign_contiguous_type_tags_to_union_alternatives(alternatives);
+    return llvm_type_def;
 }
 
 llvm::Type* TypeDefinitionsLLVMTranslator::translate_struct_to_llvm_type(
     const StructDefinition& struct_definition
 ) {
-    std::string fully_qualified_name = program_representation.get_fully_qualified_typedefinition_name(struct_definition);
-    if (llvm_type_definitions.find(fully_qualified_name) != llvm_type_definitions.end()) {
-        return llvm_type_definitions.at(fully_qualified_name);
+    const TypeId struct_definition_type_id = program_representation.get_typedefinition_id(struct_definition);
+    auto search_outcome = llvm_type_definitions.find(struct_definition_type_id);
+    if (search_outcome != llvm_type_definitions.end()) {
+        return search_outcome->second;
     }
+    const std::string& fully_qualified_name = program_representation.get_fully_qualified_name(struct_definition_type_id);
     llvm::StructType* llvm_type_def = llvm::StructType::create(context, fully_qualified_name);
-    llvm_type_definitions.insert({fully_qualified_name, llvm_type_def});
+    llvm_type_definitions.insert({struct_definition_type_id, llvm_type_def});
     std::vector<llvm::Type*> fields_types;
     fields_types.reserve(struct_definition.fields.size());
     for (const StructDefinition::Field& field : struct_definition.fields) {
@@ -120,5 +136,5 @@ llvm::Type* TypeDefinitionsLLVMTranslator::translate_struct_to_llvm_type(
         fields_types.push_back(llvm::Type::getInt1Ty(context));
     }
     llvm_type_def->setBody(fields_types);
-    return llvm_type_definitions.at(fully_qualified_name);
+    return llvm_type_def;
 }
\ No newline at end of file
@@ -8,12 +8,22 @@
 #include "errors/internal_errors.hpp"
 #include "syntax/primitive_types.hpp"
 
+static bool is_integer_primitive_type(const TypeSignature& type_signature) {
+    if (!type_signature.is<PrimitiveType>()) {
+        return false;
+    }
+    const std::string& type_name = type_signature.get<PrimitiveType>().type_name;
+    return type_name == int_type || type_name == int32_type;
+}
+
 TypeManipulationsLLVMTranslator::TypeManipulationsLLVMTranslator(
     ProgramRepresentation& program_representation, 
-    TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator
+    TypeDefinitionsLLVMTranslator& type_definitions_llvm_translator,
+    FrameSlotsAllocator& frame_slots_allocator
 )
     : program_representation(program_representation)
     , type_definitions_llvm_translator(type_definitions_llvm_translator)
+    , frame_slots_allocator(frame_slots_allocator)
 { }
 
 TypeManipulationsLLVMTranslator::CastStrategy 
@@ -51,6 +61,12 @@ TypeManipulationsLLVMTranslator::compute_cast_strategy(
     bool dest_is_array = dest.is<ArrayType>();
     if (source_is_array && dest_is_array) return CastStrategy::array_to_array;
 
+    bool source_is_integer = is_integer_primitive_type(source);
+    bool dest_is_integer = is_integer_primitive_type(dest);
+    bool integer_width_changes = source_is_integer && dest_is_integer &&
+        source.get<PrimitiveType>().type_name != dest.get<PrimitiveType>().type_name;
+    if (integer_width_changes) return CastStrategy::integer_to_integer;
+
     return CastStrategy::noop;
 }
 
@@ -90,6 +106,9 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_translated_expression
             const ArrayType& dest_array_type = dest.get<ArrayType>();
             return cast_array_to_array_of_another_type_in_llvm(block, expression, src_array_type, dest_array_type);
         }
+        case CastStrategy::integer_to_integer: {
+            return cast_integer_to_integer_of_another_width_in_llvm(block, expression, dest);
+        }
     }
     return expression;
 }
\ No newline at end of file
@@ -18,7 +18,7 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_pointer_to_array_to_s
     size_t array_length = source_array_type.array_length;
     llvm::IRBuilder<> builder(block);
     llvm::Type* llvm_slice_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(cast_dest);
-    llvm::Value* newly_created_slice_address = builder.CreateAlloca(llvm_slice_type);
+    llvm::Value* newly_created_slice_address = frame_slots_allocator.allocate_frame_slot(llvm_slice_type);
     llvm::Value* newly_created_slice_len_address = builder.CreateStructGEP(newly_created_slice_address, 0);
     llvm::Value* newly_created_slice_storage_address_address = builder.CreateStructGEP(newly_created_slice_address, 1);
     llvm::Type* llvm_int_type = type_definitions_llvm_translator.get_int_llvm_type();
@@ -27,7 +27,7 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_pointer_to_array_to_s
     llvm::Value* index_0 = llvm::ConstantInt::get(llvm_int_type, 0);
     llvm::Value* pointer_to_first = create_array_gep(builder, pointer_to_array_expression.value, index_0);
     builder.CreateStore(pointer_to_first, newly_created_slice_storage_address_address);
-    return builder.CreateLoad(newly_created_slice_address);
+    return create_load_unless_aggregate(builder, newly_created_slice_address);
 }
 
 TranslatedExpression TypeManipulationsLLVMTranslator::cast_slice_of_chars_to_string_llvm(
@@ -35,11 +35,10 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_slice_of_chars_to_str
     TranslatedExpression slice_of_chars_expression
 ) {
     llvm::IRBuilder<> builder(block);
-    llvm::Value* slice_address = get_llvm_address(builder, slice_of_chars_expression);
+    llvm::Value* slice_address = get_llvm_address(builder, frame_slots_allocator, slice_of_chars_expression);
     llvm::Type* llvm_string_type = type_definitions_llvm_translator.get_string_llvm_type();
     llvm::Value* casted_slice_address = builder.CreateBitCast(slice_address, llvm_string_type->getPointerTo());
-    llvm::Value* casted_slice_value = builder.CreateLoad(casted_slice_address);
-    return casted_slice_value;
+    return create_load_unless_aggregate(builder, casted_slice_address);
 }
 
 TranslatedExpression TypeManipulationsLLVMTranslator::cast_string_to_raw_string_in_llvm(
@@ -47,7 +46,7 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_string_to_raw_string_
     TranslatedExpression string_expression
 ) {
     llvm::IRBuilder<> builder(block);
-    llvm::Value* string_address = get_llvm_address(builder, string_expression);
+    llvm::Value* string_address = get_llvm_address(builder, frame_slots_allocator, string_expression);
     llvm::Type* llvm_raw_string_type = type_definitions_llvm_translator.get_raw_string_llvm_type();
     llvm::Value* first_char_address_address = builder.CreateStructGEP(string_address, 1);
     llvm::Value* first_char_address = builder.CreateLoad(first_char_address_address);
@@ -55,6 +54,17 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_string_to_raw_string_
     return casted_raw_string;
 }
 
+TranslatedExpression TypeManipulationsLLVMTranslator::cast_integer_to_integer_of_another_width_in_llvm(
+    llvm::BasicBlock* block,
+    TranslatedExpression integer_expression,
+    const TypeSignature& dest_type
+) {
+    llvm::IRBuilder<> builder(block);
+    llvm::Value* integer_value = get_llvm_value(builder, integer_expression);
+    llvm::Type* llvm_dest_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(dest_type);
+    return builder.CreateSExtOrTrunc(integer_value, llvm_dest_type);
+}
+
 TranslatedExpression TypeManipulationsLLVMTranslator::cast_array_to_array_of_another_type_in_llvm(
     llvm::BasicBlock* block,
     TranslatedExpression array_expression,
@@ -63,20 +73,18 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_array_to_array_of_ano
 ) {
     assert(source_array_type.array_length == dest_array_type.array_length);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* source_array_address = get_llvm_address(builder, array_expression);
+    llvm::Value* source_array_address = get_llvm_address(builder, frame_slots_allocator, array_expression);
     llvm::Type* dest_llvm_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(dest_array_type);
-    llvm::Value* dest_array_address = builder.CreateAlloca(dest_llvm_type);
+    llvm::Value* dest_array_address = frame_slots_allocator.allocate_frame_slot(dest_llvm_type);
     for (size_t i = 0; i < source_array_type.array_length; i++) {
         llvm::Value* index_llvm_value = llvm::ConstantInt::get(builder.getInt32Ty(), i);
         llvm::Value* source_element_address = create_array_gep(builder, source_array_address, index_llvm_value);
-        llvm::Value* source_element_value = builder.CreateLoad(source_element_address);
         llvm::Value* dest_element_address = create_array_gep(builder, dest_array_address, index_llvm_value);
-        TranslatedExpression source_element(source_element_value, source_array_address);
+        TranslatedExpression source_element = create_load_unless_aggregate(builder, source_element_address);
         TranslatedExpression casted_source_element = cast_translated_expression_to_another_type_in_llvm(
             block, source_element, source_array_type.stored_type, dest_array_type.stored_type
         );
-        builder.CreateStore(casted_source_element.value, dest_element_address);
+        create_store_or_aggregate_copy(builder, casted_source_element, dest_element_address, false);
     }
-    llvm::Value* dest_array_value = builder.CreateLoad(dest_array_address);
-    return dest_array_value;
+    return create_load_unless_aggregate(builder, dest_array_address);
 }
\ No newline at end of file
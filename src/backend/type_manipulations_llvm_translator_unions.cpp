@@ -6,25 +6,62 @@
 #include "backend/type_manipulations_llvm_translator.hpp"
 #include "backend/llvm_wrappers.hpp"
 
-#include <iostream>
+llvm::Value* TypeManipulationsLLVMTranslator::extract_type_tag_from_union_in_llvm(
+    llvm::BasicBlock* block,
+    TranslatedExpression union_expression
+) {
+    llvm::IRBuilder<> builder(block);
+    llvm::Value* union_address = get_llvm_address(builder, frame_slots_allocator, union_expression);
+    llvm::Value* union_header_address = builder.CreateStructGEP(union_address, 0);
+    return builder.CreateLoad(union_header_address);
+}
 
 TranslatedExpression TypeManipulationsLLVMTranslator::test_concrete_type_of_union_in_llvm(
     llvm::BasicBlock* block,
     TranslatedExpression union_expression,
     const TypeSignature& type_to_check
+) {
+    llvm::Value* union_type_tag = extract_type_tag_from_union_in_llvm(block, union_expression);
+    std::vector<llvm::ConstantInt*> expected_type_tags = type_definitions_llvm_translator
+        .fetch_all_type_tags_matching_type(type_to_check);
+    return test_type_tag_membership_in_llvm(block, union_type_tag, expected_type_tags);
+}
+
+TranslatedExpression TypeManipulationsLLVMTranslator::test_type_tag_membership_in_llvm(
+    llvm::BasicBlock* block,
+    llvm::Value* type_tag,
+    const std::vector<llvm::ConstantInt*>& sorted_expected_type_tags
 ) {
     llvm::IRBuilder<> builder(block);
-    llvm::Value* union_address = get_llvm_address(builder, union_expression);
-    llvm::Value* union_header_address = builder.CreateStructGEP(union_address, 0);
-    llvm::Value* union_header = builder.CreateLoad(union_header_address);
-    llvm::GlobalVariable* expected_type_info = type_definitions_llvm_translator.fetch_type_info(type_to_check);
-    llvm::Value* casted_expected_type_info = builder.CreateBitCast(expected_type_info, union_header->getType());
-    llvm::Value* is_operator_result = builder.CreateICmpEQ(union_header, casted_expected_type_info);
-    std::vector<llvm::GlobalVariable*> alternative_type_infos = type_definitions_llvm_translator
-        .fetch_all_type_infos_for_non_union_compatible_types(type_to_check);
-    for (llvm::GlobalVariable* alternative_type_info : alternative_type_infos) {
-        llvm::Value* casted_alternative_type_info = builder.CreateBitCast(alternative_type_info, union_header->getType());
-        llvm::Value* is_current_type = builder.CreateICmpEQ(union_header, casted_alternative_type_info);
+    if (sorted_expected_type_tags.empty()) {
+        return builder.getFalse();
+    }
+    if (sorted_expected_type_tags.size() == 1) {
+        return builder.CreateICmpEQ(type_tag, sorted_expected_type_tags.front());
+    }
+    const uint64_t lowest_tag = sorted_expected_type_tags.front()->getZExtValue();
+    const uint64_t highest_tag = sorted_expected_type_tags.back()->getZExtValue();
+    llvm::Type* type_tag_type = type_tag->getType();
+    if (highest_tag - lowest_tag + 1 == sorted_expected_type_tags.size()) {
+        llvm::Value* offset_from_lowest_tag = builder.CreateSub(type_tag, sorted_expected_type_tags.front());
+        llvm::Value* range_width = llvm::ConstantInt::get(type_tag_type, highest_tag - lowest_tag);
+        return builder.CreateICmpULE(offset_from_lowest_tag, range_width);
+    }
+    const uint64_t bitmask_width = type_tag_type->getIntegerBitWidth();
+    if (highest_tag < bitmask_width) {
+        uint64_t expected_type_tags_bitmask = 0;
+        for (llvm::ConstantInt* expected_type_tag : sorted_expected_type_tags) {
+            expected_type_tags_bitmask |= uint64_t(1) << expected_type_tag->getZExtValue();
+        }
+        llvm::Value* tag_fits_in_bitmask = builder.CreateICmpULT(type_tag, llvm::ConstantInt::get(type_tag_type, bitmask_width));
+        llvm::Value* tag_bit = builder.CreateShl(llvm::ConstantInt::get(type_tag_type, 1), type_tag);
+        llvm::Value* masked_tag_bit = builder.CreateAnd(tag_bit, llvm::ConstantInt::get(type_tag_type, expected_type_tags_bitmask));
+        llvm::Value* tag_bit_is_set = builder.CreateICmpNE(masked_tag_bit, llvm::ConstantInt::get(type_tag_type, 0));
+        return builder.CreateSelect(tag_fits_in_bitmask, tag_bit_is_set, builder.getFalse());
+    }
+    llvm::Value* is_operator_result = builder.CreateICmpEQ(type_tag, sorted_expected_type_tags.front());
+    for (size_t tag_index = 1; tag_index < sorted_expected_type_tags.size(); tag_index++) {
+        llvm::Value* is_current_type = builder.CreateICmpEQ(type_tag, sorted_expected_type_tags[tag_index]);
         is_operator_result = builder.CreateOr(is_operator_result, is_current_type);
     }
     return is_operator_result;
@@ -37,18 +74,17 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_union_expression_to_a
 ) {
     llvm::Type* llvm_dest_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(dest_type);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* src_union_address = get_llvm_address(builder, union_expression);
+    llvm::Value* src_union_address = get_llvm_address(builder, frame_slots_allocator, union_expression);
     llvm::Value* src_union_header_address = builder.CreateStructGEP(src_union_address, 0);
-    llvm::Value* src_union_payload_address = builder.CreateStructGEP(src_union_address, 0);
+    llvm::Value* src_union_payload_address = builder.CreateStructGEP(src_union_address, 1);
     llvm::Value* src_union_header = builder.CreateLoad(src_union_header_address);
-    llvm::Value* src_union_payload = builder.CreateLoad(src_union_payload_address);
-    llvm::Value* dest_union_address = builder.CreateAlloca(llvm_dest_type);
+    llvm::Value* dest_union_address = frame_slots_allocator.allocate_frame_slot(llvm_dest_type);
     llvm::Value* dest_union_header_address = builder.CreateStructGEP(dest_union_address, 0);
-    llvm::Value* dest_union_payload_address = builder.CreateStructGEP(dest_union_address, 0);
+    llvm::Value* dest_union_payload_address = builder.CreateStructGEP(dest_union_address, 1);
     builder.CreateStore(src_union_header, dest_union_header_address);
-    builder.CreateStore(src_union_payload, dest_union_payload_address);
-    llvm::Value* dest_union_value = builder.CreateLoad(dest_union_address);
-    return {dest_union_value, dest_union_address};
+    TranslatedExpression src_union_payload = create_load_unless_aggregate(builder, src_union_payload_address);
+    create_store_or_aggregate_copy(builder, src_union_payload, dest_union_payload_address, false);
+    return create_load_unless_aggregate(builder, dest_union_address);
 }
 
 TranslatedExpression TypeManipulationsLLVMTranslator::cast_union_expression_as_ref_to_another_union_type_in_llvm(
@@ -57,13 +93,10 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_union_expression_as_r
     const TypeSignature& dest_type
 ) {
     llvm::IRBuilder<> builder(block);
-    llvm::Value* union_address = get_llvm_address(builder, union_expression);
+    llvm::Value* union_address = get_llvm_address(builder, frame_slots_allocator, union_expression);
     llvm::Type* llvm_dest_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(dest_type);
     llvm::Value* casted_union_payload_address = builder.CreateBitCast(union_address, llvm_dest_type->getPointerTo());
-    llvm::Value* casted_union_payload = builder.CreateLoad(casted_union_payload_address);
-    return (union_expression.address == nullptr)
-        ? TranslatedExpression(casted_union_payload)
-        : TranslatedExpression(casted_union_payload, casted_union_payload_address);
+    return create_load_unless_aggregate(builder, casted_union_payload_address, union_expression.address != nullptr);
 }
 
 TranslatedExpression TypeManipulationsLLVMTranslator::cast_union_expression_to_one_of_its_alternatives_in_llvm(
@@ -73,13 +106,10 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_union_expression_to_o
 ) {
     llvm::Type* llvm_dest_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(dest_type);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* union_address = get_llvm_address(builder, union_expression);
+    llvm::Value* union_address = get_llvm_address(builder, frame_slots_allocator, union_expression);
     llvm::Value* union_payload_address = builder.CreateStructGEP(union_address, 1);
     llvm::Value* casted_union_payload_address = builder.CreateBitCast(union_payload_address, llvm_dest_type->getPointerTo());
-    llvm::Value* casted_union_payload = builder.CreateLoad(casted_union_payload_address);
-    return (union_expression.address == nullptr)
-        ? TranslatedExpression(casted_union_payload)
-        : TranslatedExpression(casted_union_payload, casted_union_payload_address);
+    return create_load_unless_aggregate(builder, casted_union_payload_address, union_expression.address != nullptr);
 }
 
 TranslatedExpression TypeManipulationsLLVMTranslator::cast_simple_expression_to_union_in_llvm(
@@ -90,15 +120,15 @@ TranslatedExpression TypeManipulationsLLVMTranslator::cast_simple_expression_to_
 ) {
     llvm::Type* llvm_dest_type = type_definitions_llvm_translator.translate_typesignature_to_llvm_type(dest_type);
     llvm::IRBuilder<> builder(block);
-    llvm::Value* union_address = builder.CreateAlloca(llvm_dest_type);
+    llvm::Value* union_address = frame_slots_allocator.allocate_frame_slot(llvm_dest_type);
     llvm::Value* union_header_address = builder.CreateStructGEP(union_address, 0);
-    llvm::GlobalVariable* type_info = type_definitions_llvm_translator.fetch_type_info(soruce_type);
-    llvm::Type* union_header_type = union_header_address->getType()->getPointerElementType();
-    llvm::Value* casted_type_info = builder.CreateBitCast(type_info, union_header_type);
-    builder.CreateStore(casted_type_info, union_header_address);
+    llvm::ConstantInt* type_tag = type_definitions_llvm_translator.fetch_type_tag(soruce_type);
+    builder.CreateStore(type_tag, union_header_address);
     llvm::Value* union_payload_address = builder.CreateStructGEP(union_address, 1);
-    llvm::Value* casted_union_payload_address = builder.CreateBitCast(union_payload_address, simple_expression.value->getType()->getPointerTo());
-    builder.CreateStore(simple_expression.value, casted_union_payload_address);
-    llvm::Value* union_value = builder.CreateLoad(union_address);
-    return union_value;
+    llvm::Type* llvm_source_type = (simple_expression.value != nullptr)
+        ? simple_expression.value->getType()
+        : simple_expression.address->getType()->getPointerElementType();
+    llvm::Value* casted_union_payload_address = builder.CreateBitCast(union_payload_address, llvm_source_type->getPointerTo());
+    create_store_or_aggregate_copy(builder, simple_expression, casted_union_payload_address, false);
+    return create_load_unless_aggregate(builder, union_address);
 }
\ No newline at end of file
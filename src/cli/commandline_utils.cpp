@@ -7,6 +7,7 @@
 #include "cli/commandline.hpp"
 
 #include <iostream>
+#include <algorithm>
 
 CommandLineController::CommandLineController(int argc, char** argv)
     : arg_counter(argc), arg_values(argv), arg_index(1)
@@ -27,6 +28,30 @@ CommandLineController::CommandLineController(int argc, char** argv)
             parse_target_triple();
             continue;
         }
+        if (text == "--cpu") {
+            parse_target_cpu();
+            continue;
+        }
+        if (text == "--features") {
+            parse_target_features();
+            continue;
+        }
+        if (text == "-j" || text == "--jobs") {
+            parse_jobs_count();
+            continue;
+        }
+        if (text == "--stats") {
+            parse_statistics_flag();
+            continue;
+        }
+        if (text == "--time-trace") {
+            parse_time_trace_file();
+            continue;
+        }
+        if (text.rfind("-O", 0) == 0) {
+            parse_optimization_level();
+            continue;
+        }
         throw_unrecognized_flag(arg_values, arg_index);
     }
 }
@@ -62,6 +87,51 @@ void CommandLineController::parse_target_triple() {
     avoid_lack_of_target_triple(target_triple);
 }
 
+void CommandLineController::parse_target_cpu() {
+    if (++arg_index < arg_counter) {
+        target_cpu = arg_values[arg_index++];
+    } 
+    avoid_lack_of_target_cpu(target_cpu);
+}
+
+void CommandLineController::parse_target_features() {
+    if (++arg_index < arg_counter) {
+        target_features = arg_values[arg_index++];
+    } 
+    avoid_lack_of_target_features(target_features);
+}
+
+void CommandLineController::parse_jobs_count() {
+    std::optional<std::string> jobs_count_text;
+    if (++arg_index < arg_counter) {
+        jobs_count_text = arg_values[arg_index++];
+    }
+    avoid_lack_of_jobs_count(jobs_count_text);
+    bool is_positive_number = !jobs_count_text->empty() && jobs_count_text->size() <= 4 &&
+        std::all_of(jobs_count_text->begin(), jobs_count_text->end(), ::isdigit) &&
+        std::stoul(*jobs_count_text) > 0;
+    if (!is_positive_number) {
+        throw_invalid_jobs_count(*jobs_count_text);
+    }
+    jobs_count = std::stoul(*jobs_count_text);
+}
+
+void CommandLineController::parse_statistics_flag() {
+    statistics_requested = true;
+    arg_index++;
+}
+
+void CommandLineController::parse_time_trace_file() {
+    if (++arg_index < arg_counter) {
+        time_trace_file = arg_values[arg_index++];
+    }
+    avoid_lack_of_time_trace_file(time_trace_file);
+}
+
+void CommandLineController::parse_optimization_level() {
+    optimization_level = extract_optimization_level(arg_values[arg_index++]);
+}
+
 void CommandLineController::parse_input_files() {
     while (++arg_index < arg_counter && arg_values[arg_index][0] != '-') {
         inputs.emplace_back(arg_values[arg_index]);
@@ -12,6 +12,10 @@ void CommandLineController::version_subcommand() {
     ensure_lack_of_output_files(outputs);
     ensure_lack_of_input_files(inputs);
     ensure_lack_of_target_triple(target_triple);
+    ensure_lack_of_target_cpu(target_cpu);
+    ensure_lack_of_target_features(target_features);
+    ensure_lack_of_optimization_level(optimization_level);
+    ensure_lack_of_jobs_count(jobs_count);
 
 
     std::cout << R"(                   ____                   ____                      )" << std::endl;
@@ -30,6 +34,10 @@ void CommandLineController::help_subcommand() {
     ensure_lack_of_output_files(outputs);
     ensure_lack_of_input_files(inputs);
     ensure_lack_of_target_triple(target_triple);
+    ensure_lack_of_target_cpu(target_cpu);
+    ensure_lack_of_target_features(target_features);
+    ensure_lack_of_optimization_level(optimization_level);
+    ensure_lack_of_jobs_count(jobs_count);
     version_subcommand();
     std::cout << "                                                                       " << std::endl;
     std::cout << "The command line interface (CLI) exposes the following subcommands:    " << std::endl;
@@ -39,19 +47,19 @@ void CommandLineController::help_subcommand() {
     std::cout << "properly. The order in which the flags are provided doesn't matter.    " << std::endl;
     std::cout << "                                                                       " << std::endl;
     std::cout << "                                                                       " << std::endl;
-    std::cout << "               +------------+-------------+-------------+              " << std::endl;
-    std::cout << "               | -i --input | -o --output | -t --target |              " << std::endl;
-    std::cout << "   +-----------+------------+-------------+-------------+              " << std::endl;
-    std::cout << "   | help      |            |             |             |              " << std::endl;
-    std::cout << "   +-----------+------------+-------------+-------------+              " << std::endl;
-    std::cout << "   | version   |            |             |             |              " << std::endl;
-    std::cout << "   +-----------+------------+-------------+-------------+              " << std::endl;
-    std::cout << "   | compile   |  REQUIRED  |   REQUIRED  |   ALLOWED   |              " << std::endl;
-    std::cout << "   +-----------+------------+-------------+-------------+              " << std::endl;
-    std::cout << "   | run       |  REQUIRED  |             |             |              " << std::endl;
-    std::cout << "   +-----------+------------+-------------+-------------+              " << std::endl;
-    std::cout << "   | typecheck |  REQUIRED  |             |             |              " << std::endl;
-    std::cout << "   +-----------+------------+-------------+-------------+              " << std::endl;
+    std::cout << "               +------------+-------------+-------------+------------+ " << std::endl;
+    std::cout << "               | -i --input | -o --output | -t --target | -O<level>  | " << std::endl;
+    std::cout << "   +-----------+------------+-------------+-------------+------------+ " << std::endl;
+    std::cout << "   | help      |            |             |             |            | " << std::endl;
+    std::cout << "   +-----------+------------+-------------+-------------+------------+ " << std::endl;
+    std::cout << "   | version   |            |             |             |            | " << std::endl;
+    std::cout << "   +-----------+------------+-------------+-------------+------------+ " << std::endl;
+    std::cout << "   | compile   |  REQUIRED  |   REQUIRED  |   ALLOWED   |  ALLOWED   | " << std::endl;
+    std::cout << "   +-----------+------------+-------------+-------------+------------+ " << std::endl;
+    std::cout << "   | run       |  REQUIRED  |             |             |  ALLOWED   | " << std::endl;
+    std::cout << "   +-----------+------------+-------------+-------------+------------+ " << std::endl;
+    std::cout << "   | typecheck |  REQUIRED  |             |             |            | " << std::endl;
+    std::cout << "   +-----------+------------+-------------+-------------+------------+ " << std::endl;
     std::cout << "                                                                       " << std::endl;
     std::cout << "                                                                       " << std::endl;
     std::cout << "Flags must be specified in such a way that following                   " << std::endl;
@@ -75,4 +83,28 @@ void CommandLineController::help_subcommand() {
     std::cout << "-t --target:                                                           " << std::endl;
     std::cout << "  Must be followed by a target-triple.                                 " << std::endl;
     std::cout << "  The triple has the general format <arch><sub>-<vendor>-<sys>-<env>.  " << std::endl;
+    std::cout << "                                                                       " << std::endl;
+    std::cout << "--cpu --features:                                                      " << std::endl;
+    std::cout << "  Allowed when compiling and when running (`run` defaults to native).  " << std::endl;
+    std::cout << "  --cpu must be followed either by `native` (the cpu of this machine)  " << std::endl;
+    std::cout << "  or by the name of a processor supported by the target (e.g. skylake)." << std::endl;
+    std::cout << "  --features must be followed by a comma-separated list of features    " << std::endl;
+    std::cout << "  to enable or disable (e.g. +avx2,+bmi2,-sse4a).                      " << std::endl;
+    std::cout << "                                                                       " << std::endl;
+    std::cout << "-O0 -O1 -O2 -O3 -Os:                                                   " << std::endl;
+    std::cout << "  Selects the optimization level (defaults to -O0).                    " << std::endl;
+    std::cout << "  -O1, -O2 and -O3 run increasingly aggressive optimization pipelines, " << std::endl;
+    std::cout << "  -Os optimizes for code size.                                         " << std::endl;
+    std::cout << "                                                                       " << std::endl;
+    std::cout << "-j --jobs:                                                             " << std::endl;
+    std::cout << "  Allowed when compiling, running and typechecking. Must be followed   " << std::endl;
+    std::cout << "  by the number of threads used to tokenize and parse the input files  " << std::endl;
+    std::cout << "  (defaults to 1). Errors are still reported in input-file order.      " << std::endl;
+    std::cout << "                                                                       " << std::endl;
+    std::cout << "--stats --time-trace:                                                  " << std::endl;
+    std::cout << "  Allowed when compiling, running and typechecking. --stats prints the " << std::endl;
+    std::cout << "  time spent in each compilation phase together with some counters     " << std::endl;
+    std::cout << "  (tokens, AST nodes, overload resolutions, generic instantiations...)." << std::endl;
+    std::cout << "  --time-trace must be followed by a `.json` file, where the same data " << std::endl;
+    std::cout << "  is written in the Chrome trace-event format (chrome://tracing).      " << std::endl;
 }
\ No newline at end of file
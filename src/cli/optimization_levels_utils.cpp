@@ -0,0 +1,16 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "cli/optimization_levels.hpp"
+#include "errors/commandline_errors.hpp"
+
+OptimizationLevel extract_optimization_level(const std::string& flag) {
+    if (flag == "-O0") return OptimizationLevel::O0;
+    if (flag == "-O1") return OptimizationLevel::O1;
+    if (flag == "-O2") return OptimizationLevel::O2;
+    if (flag == "-O3") return OptimizationLevel::O3;
+    if (flag == "-Os") return OptimizationLevel::Os;
+    throw_unrecognized_optimization_level(flag);
+}
\ No newline at end of file
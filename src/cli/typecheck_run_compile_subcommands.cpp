@@ -4,53 +4,128 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <fstream>
 
-#include "frontend/tokenizer.hpp"
+#include "frontend/mapped_tokenizer.hpp"
 #include "cli/commandline.hpp"
 #include "frontend/parser.hpp"
 #include "preprocessing/preprocessor.hpp"
 #include "backend/finalizer.hpp"
 #include "errors/commandline_errors.hpp"
+#include "misc/compilation_statistics.hpp"
+#include "misc/ast_arena.hpp"
+
+static std::vector<FileRepresentation> tokenize_and_parse_input_files(
+    const std::vector<std::string>& inputs, 
+    size_t jobs_count,
+    AstArena& ast_arena
+) {
+    SourceFilesRegistry source_files_registry;
+    std::vector<SourceFilesRegistry::FileId> file_ids;
+    for (const std::string& input_file : inputs) {
+        file_ids.push_back(source_files_registry.map_source_file(input_file));
+    }
+    std::vector<std::optional<FileRepresentation>> parsed_files(inputs.size());
+    std::vector<std::exception_ptr> encountered_errors(inputs.size());
+    std::atomic<size_t> next_file_index = 0;
+    std::atomic<size_t> first_failed_file_index = inputs.size();
+    auto tokenize_and_parse_worker = [&]() {
+        AstArena::Scope ast_arena_scope(ast_arena);
+        for (size_t index = next_file_index++; index < inputs.size(); index = next_file_index++) {
+            if (index > first_failed_file_index) {
+                return;
+            }
+            try {
+                TokenizedFile tokenized_file = [&]() {
+                    ScopedPhaseTimer phase_timer("Tokenizer", inputs[index]);
+                    MappedTokenizer tokenizer(source_files_registry, file_ids[index]);
+                    return tokenizer.tokenize();
+                }();
+                ScopedPhaseTimer phase_timer("Parser", inputs[index]);
+                Parser parser(tokenized_file);
+                parsed_files[index] = parser.parse_everything();
+            }
+            catch (...) {
+                encountered_errors[index] = std::current_exception();
+                size_t first_failed = first_failed_file_index;
+                while (index < first_failed && !first_failed_file_index.compare_exchange_weak(first_failed, index));
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t worker = 1; worker < std::min(jobs_count, inputs.size()); worker++) {
+        workers.emplace_back(tokenize_and_parse_worker);
+    }
+    tokenize_and_parse_worker();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    std::vector<FileRepresentation> file_representations;
+    file_representations.reserve(inputs.size());
+    for (size_t index = 0; index < inputs.size(); index++) {
+        if (encountered_errors[index] != nullptr) {
+            std::rethrow_exception(encountered_errors[index]);
+        }
+        file_representations.push_back(std::move(*parsed_files[index]));
+    }
+    return file_representations;
+}
+
+void CommandLineController::report_compilation_statistics() {
+    if (statistics_requested) {
+        CompilationStatistics::print_summary(std::cout);
+    }
+    if (time_trace_file.has_value()) {
+        std::ofstream time_trace_output(*time_trace_file);
+        ensure_time_trace_file_is_open(time_trace_output, *time_trace_file);
+        CompilationStatistics::write_chrome_trace(time_trace_output);
+    }
+}
 
 void CommandLineController::typechecker_subcommand() {
     ensure_lack_of_output_files(outputs);
     ensure_lack_of_target_triple(target_triple);
+    ensure_lack_of_target_cpu(target_cpu);
+    ensure_lack_of_target_features(target_features);
+    ensure_lack_of_optimization_level(optimization_level);
     validate_input_files();
-    std::vector<FileRepresentation> file_representations;
-    for (const std::string& input_file : inputs) {
-        Tokenizer tokenizer(input_file);
-        TokenizedFile tokenized_file = tokenizer.tokenize();
-        Parser parser(tokenized_file);
-        FileRepresentation file_representation = parser.parse_everything();
-        file_representations.push_back(file_representation);
-    }
+    AstArena ast_arena;
+    std::vector<FileRepresentation> file_representations = tokenize_and_parse_input_files(inputs, jobs_count.value_or(1), ast_arena);
     ProjectFileStructure project_file_structure(file_representations);
     ProgramRepresentation program_representation(project_file_structure);
     PreProcessor preprocessor(program_representation);
     preprocessor.preprocess_packages_typename_conflicts();
     preprocessor.preprocess_type_definitions();
     preprocessor.preprocess_function_definitions();
+    report_compilation_statistics();
 }
 
 void CommandLineController::compiler_subcommand() {
     validate_output_files();
     validate_input_files();
-    std::vector<FileRepresentation> file_representations;
-    for (const std::string& input_file : inputs) {
-        Tokenizer tokenizer(input_file);
-        TokenizedFile tokenized_file = tokenizer.tokenize();
-        Parser parser(tokenized_file);
-        FileRepresentation file_representation = parser.parse_everything();
-        file_representations.push_back(file_representation);
-    }
+    AstArena ast_arena;
+    std::vector<FileRepresentation> file_representations = tokenize_and_parse_input_files(inputs, jobs_count.value_or(1), ast_arena);
     ProjectFileStructure project_file_structure(file_representations);
     ProgramRepresentation program_representation(project_file_structure);
     PreProcessor preprocessor(program_representation);
     preprocessor.preprocess_packages_typename_conflicts();
     preprocessor.preprocess_type_definitions();
     preprocessor.preprocess_function_definitions();
-    Finalizer finalizer(program_representation, target_triple);
+    Finalizer finalizer(
+        program_representation, 
+        target_triple, 
+        target_cpu, 
+        target_features, 
+        optimization_level.value_or(OptimizationLevel::O0)
+    );
     finalizer.generate_llvm_ir();
+    finalizer.optimize_llvm_ir();
     for (const std::string& output_file : outputs) {
         switch (extract_file_extension(output_file)) {
             break; case FileExtension::llvm: finalizer.emit_llvm_ir(output_file);
@@ -59,11 +134,32 @@ void CommandLineController::compiler_subcommand() {
             break; case FileExtension::basalt: throw_basalt_used_as_output(output_file);
         }
     }
+    report_compilation_statistics();
 }
 
 void CommandLineController::interpreter_subcommand() {
-    using CompilationError::Kind::CommandLineError;
-    CompilationError::raise<CommandLineError>(
-        "`run` subcommand not yet implemented"
+    auto startup_instant = std::chrono::steady_clock::now();
+    ensure_lack_of_output_files(outputs);
+    ensure_lack_of_target_triple(target_triple);
+    validate_input_files();
+    AstArena ast_arena;
+    std::vector<FileRepresentation> file_representations = tokenize_and_parse_input_files(inputs, jobs_count.value_or(1), ast_arena);
+    ProjectFileStructure project_file_structure(file_representations);
+    ProgramRepresentation program_representation(project_file_structure);
+    PreProcessor preprocessor(program_representation);
+    preprocessor.preprocess_packages_typename_conflicts();
+    preprocessor.preprocess_type_definitions();
+    preprocessor.preprocess_function_definitions();
+    Finalizer finalizer(
+        program_representation, 
+        std::nullopt, 
+        target_cpu.value_or("native"), 
+        target_features, 
+        optimization_level.value_or(OptimizationLevel::O0)
     );
+    finalizer.generate_llvm_ir();
+    finalizer.optimize_llvm_ir();
+    report_compilation_statistics();
+    int program_exit_code = finalizer.execute_llvm_ir_just_in_time(startup_instant);
+    exit(program_exit_code);
 }
\ No newline at end of file
@@ -44,19 +44,25 @@ bool AssignmentTypeChecker::structural_equivalence_assignment_validation(
     const TypeSignature& dest,
     bool strict_mode
 ) {
-    std::vector<TypeSignature> dest_union_alternatives = 
+    const std::vector<TypeSignature>& dest_union_alternatives = 
         type_definitions_register.fetch_union_alternatives(dest);
     if (dest_union_alternatives.empty()) {
         return false;
     }
+    if (type_definitions_register.is_union_member(dest, source)) {
+        return true;
+    }
     if (validate_assignment_to_union_alternatives(source, dest_union_alternatives, strict_mode)) {
         return true;
     }
-    std::vector<TypeSignature> source_union_alternatives = 
+    const std::vector<TypeSignature>& source_union_alternatives = 
         type_definitions_register.fetch_union_alternatives(source);
     if (source_union_alternatives.empty()) {
         return false;
     }
+    if (type_definitions_register.is_union_subset(source, dest)) {
+        return true;
+    }
     for (const TypeSignature& alternative : source_union_alternatives) {
         if (!validate_assignment_to_union_alternatives(alternative, dest_union_alternatives, strict_mode)) {
             return false;
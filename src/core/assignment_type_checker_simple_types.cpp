@@ -7,14 +7,24 @@
 #include "errors/preprocessing_errors.hpp"
 #include "errors/internal_errors.hpp"
 
+static bool is_integer_type_name(const std::string& type_name) {
+    return type_name == int_type || type_name == int32_type;
+}
+
 bool AssignmentTypeChecker::validate_assignment_to_primitive_type(
     const TypeSignature& source, 
     const PrimitiveType& dest,
     bool strict_mode
 ) {
-    return (dest.type_name == string_type || dest.type_name == raw_string_type)
-        ? validate_assignment_to_string(source, dest, strict_mode)
-        : source.is<PrimitiveType>() && source.get<PrimitiveType>().type_name == dest.type_name;
+    if (dest.type_name == string_type || dest.type_name == raw_string_type) {
+        return validate_assignment_to_string(source, dest, strict_mode);
+    }
+    if (!source.is<PrimitiveType>()) {
+        return false;
+    }
+    const std::string& source_type_name = source.get<PrimitiveType>().type_name;
+    return source_type_name == dest.type_name 
+        || (!strict_mode && is_integer_type_name(source_type_name) && is_integer_type_name(dest.type_name));
 }
 
 bool AssignmentTypeChecker::validate_assignment_to_slice_type(
@@ -83,7 +83,9 @@ bool AssignmentTypeChecker::validate_assignment_to_template_generic(
                 return !already_locked;
             }
             else if (rule.replacement.is<InlineUnion>()) {
-                rule.replacement.get<InlineUnion>().alternatives.push_back(source);
+                InlineUnion extended_union = rule.replacement.get<InlineUnion>();
+                extended_union.alternatives.push_back(source);
+                rule.replacement = extended_union;
                 return !already_locked;
             }
             else {
@@ -18,7 +18,7 @@ std::string CachingAwareRegister::get_cache_search_key_for_func_def_retrieval_fr
     search_key += namespace_concatenation + function_call.function_name;
     search_key += "<" + std::to_string(function_call.instantiated_generics.size()) + ">";
     for (const TypeSignature& arg_type : arg_types) {
-        search_key += type_definitions_register.get_fully_qualified_typesignature_name(arg_type);
+        search_key += std::to_string(type_definitions_register.get_typesignature_id(arg_type));
         search_key += ";";
     }
     return search_key;
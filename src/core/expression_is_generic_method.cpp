@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "language/expressions.hpp"
+#include "language/functions.hpp"
+
+bool Expression::is_generic() const {
+    return generic_bit;
+}
+
+bool FunctionCall::is_generic() const {
+    for (const TypeSignature& instantiated_generic : instantiated_generics) {
+        if (instantiated_generic.is_generic()) {
+            return true;
+        }
+    }
+    for (const Expression& argument : arguments) {
+        if (argument.is_generic()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ArrayLiteral::is_generic() const {
+    if (stored_type.is_generic()) {
+        return true;
+    }
+    for (const Expression& element : elements) {
+        if (element.is_generic()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TypeOperator::is_generic() const {
+    return expression.is_generic() || typesignature.is_generic();
+}
+
+bool BinaryOperator::is_generic() const {
+    return left_operand.is_generic() || right_operand.is_generic();
+}
+
+bool UnaryOperator::is_generic() const {
+    return operand.is_generic();
+}
+
+bool DotMemberAccess::is_generic() const {
+    return struct_value.is_generic();
+}
+
+bool SquareBracketsAccess::is_generic() const {
+    return storage.is_generic() || index.is_generic();
+}
+
+bool Identifier::is_generic() const {
+    return false;
+}
+
+bool StringLiteral::is_generic() const {
+    return false;
+}
+
+bool IntLiteral::is_generic() const {
+    return false;
+}
+
+bool FloatLiteral::is_generic() const {
+    return false;
+}
+
+bool BoolLiteral::is_generic() const {
+    return false;
+}
+
+bool CharLiteral::is_generic() const {
+    return false;
+}
\ No newline at end of file
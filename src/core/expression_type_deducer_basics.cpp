@@ -3,8 +3,11 @@
 // LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include <algorithm>
+
 #include "core/expression_type_deducer.hpp"
 #include "core/function_call_resolver.hpp"
+#include "core/typed_expressions_table.hpp"
 #include "errors/preprocessing_errors.hpp"
 #include "errors/internal_errors.hpp"
 
@@ -25,6 +28,19 @@ ExpressionTypeDeducer::ExpressionTypeDeducer(
 std::optional<TypeSignature> 
 ExpressionTypeDeducer::deduce_expression_type(
     const Expression& expression
+) {
+    TypedExpressionsTable& typed_expressions_table = scope_context.get_typed_expressions_table();
+    if (typed_expressions_table.contains_expression_type(expression)) {
+        return typed_expressions_table.get_expression_type(expression);
+    }
+    std::optional<TypeSignature> expression_type = deduce_expression_type_by_kind(expression);
+    typed_expressions_table.store_expression_type(expression, expression_type);
+    return expression_type;
+}
+
+std::optional<TypeSignature> 
+ExpressionTypeDeducer::deduce_expression_type_by_kind(
+    const Expression& expression
 ) {    
     switch (expression.expression_kind()) {
         case ExpressionBody::Kind::bool_literal:          return deduce_primtive_type(bool_type, expression);
@@ -76,18 +92,39 @@ std::optional<TypeSignature>
 ExpressionTypeDeducer::deduce_type_from_function_call(const Expression& expression) {
     assert_expression_is<FunctionCall>(expression);
     const FunctionCall& function_call = expression.get<FunctionCall>();
+    auto argument_types = deduce_argument_types_from_function_call(function_call);
+    std::optional<TypeSignature> opt_return_type = std::nullopt;
+    auto is_generic = [](const TypeSignature& argument_type) { return argument_type.is_generic(); };
+    if (std::none_of(argument_types.begin(), argument_types.end(), is_generic)) {
+        CallableCodeBlock callable_code_block = resolve_function_call(function_call, argument_types);
+        scope_context.get_typed_expressions_table().store_resolved_function_call(expression, callable_code_block);
+        opt_return_type = callable_code_block.get_return_type();
+    }
+    ensure_function_has_a_return_type(function_call, opt_return_type);
+    return type_definitions_register.unalias_type(opt_return_type.value());
+}
+
+CallableCodeBlock ExpressionTypeDeducer::resolve_function_call(const FunctionCall& function_call) {
+    std::optional<CallableCodeBlock> already_resolved = scope_context
+        .get_typed_expressions_table()
+        .search_resolved_function_call(function_call);
+    if (already_resolved.has_value()) {
+        return already_resolved.value();
+    }
+    auto argument_types = deduce_argument_types_from_function_call(function_call);
+    return resolve_function_call(function_call, argument_types);
+}
+
+CallableCodeBlock ExpressionTypeDeducer::resolve_function_call(
+    const FunctionCall& function_call,
+    const std::vector<TypeSignature>& argument_types
+) {
     FunctionCallResolver resolver(
         type_definitions_register,
         function_definitions_register, 
         common_feature_adoption_plan_generation_engine
     );
-    auto argument_types = deduce_argument_types_from_function_call(function_call);
-    auto return_type = resolver.resolve_function_call_return_type(function_call, argument_types);
-    auto opt_return_type = return_type.is<TypeSignature>() 
-        ? (std::optional<TypeSignature>) return_type.get<TypeSignature>() 
-        : (std::optional<TypeSignature>) std::nullopt;
-    ensure_function_has_a_return_type(function_call, opt_return_type);
-    return type_definitions_register.unalias_type(opt_return_type.value());
+    return resolver.resolve_function_call(function_call, argument_types);
 }
 
 std::optional<TypeSignature> 
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+
+#include "core/function_specificity_descriptor.hpp"
+#include "core/function_definitions_register.hpp"
+#include "errors/internal_errors.hpp"
+#include "syntax/primitive_types.hpp"
+
+static const std::string any_first_argument_category = "*";
+
+FunctionDefinitionsRegister::OverloadSetIndex& 
+FunctionDefinitionsRegister::retrieve_overload_set_index(const std::string& overload_set_id) {
+    auto index_search_outcome = function_definitions_overload_sets_indexes.find(overload_set_id);
+    if (index_search_outcome != function_definitions_overload_sets_indexes.end()) {
+        return index_search_outcome->second;
+    }
+    OverloadSetIndex& overload_set_index = function_definitions_overload_sets_indexes[overload_set_id];
+    for (const FunctionDefinition::Ref& func_def_ref : retrieve_specific_overload_set(overload_set_id)) {
+        const std::string category = get_first_argument_category_of_function_definition(*func_def_ref);
+        FunctionSpecificityDescriptor specificity(*func_def_ref, type_definitions_register);
+        overload_set_index[category].push_back({ func_def_ref, specificity });
+    }
+    return overload_set_index;
+}
+
+std::vector<FunctionDefinitionsRegister::OverloadCandidate> 
+FunctionDefinitionsRegister::collect_overload_candidates(
+    const FunctionCall& function_call,
+    const std::vector<TypeSignature>& arg_types
+) {
+    std::vector<OverloadCandidate> candidates;
+    std::vector<std::string> compatible_categories = get_first_argument_categories_compatible_with(arg_types);
+    for (const std::string& overload_set_id : retrieve_overload_sets_ids(function_call)) {
+        OverloadSetIndex& overload_set_index = retrieve_overload_set_index(overload_set_id);
+        // an empty list of categories means that every bucket may contain a match
+        if (compatible_categories.empty()) {
+            for (const auto& [category, bucket] : overload_set_index) {
+                candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+            }
+            continue;
+        }
+        for (const std::string& category : compatible_categories) {
+            auto bucket_search_outcome = overload_set_index.find(category);
+            if (bucket_search_outcome != overload_set_index.end()) {
+                const std::vector<OverloadCandidate>& bucket = bucket_search_outcome->second;
+                candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+            }
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const OverloadCandidate& lhs, const OverloadCandidate& rhs) {
+        return lhs.specificity.compare_with(rhs.specificity) == FunctionSpecificityDescriptor::ComparisonResult::more_specific;
+    });
+    return candidates;
+}
+
+std::string FunctionDefinitionsRegister::get_first_argument_category_of_function_definition(
+    const FunctionDefinition& function_definition
+) {
+    if (function_definition.arguments.empty()) {
+        return any_first_argument_category;
+    }
+    TypeSignature arg_type = type_definitions_register.unalias_type(function_definition.arguments[0].arg_type);
+    switch (arg_type.typesiganture_kind()) {
+        case TypeSignatureBody::Kind::pointer_type:  return "pointer";
+        case TypeSignatureBody::Kind::array_type:    return "array";
+        case TypeSignatureBody::Kind::slice_type:    return "slice";
+        case TypeSignatureBody::Kind::template_type: return any_first_argument_category;
+        case TypeSignatureBody::Kind::inline_union:  return any_first_argument_category;
+        case TypeSignatureBody::Kind::primitive_type: {
+            const std::string& type_name = arg_type.get<PrimitiveType>().type_name;
+            bool is_string = type_name == string_type || type_name == raw_string_type;
+            return (is_string) ? "string" : "primitive:" + type_name;
+        }
+        case TypeSignatureBody::Kind::custom_type: {
+            const CustomType& custom_type = arg_type.get<CustomType>();
+            TypeDefinition type_definition = type_definitions_register.retrieve_type_definition(custom_type);
+            return (type_definition.is<UnionDefinition>()) 
+                ? any_first_argument_category 
+                : "custom:" + custom_type.type_name;
+        }
+    }
+    assert_unreachable();
+}
+
+std::vector<std::string> FunctionDefinitionsRegister::get_first_argument_categories_compatible_with(
+    const std::vector<TypeSignature>& arg_types
+) {
+    if (arg_types.empty()) {
+        return { any_first_argument_category };
+    }
+    TypeSignature arg_type = type_definitions_register.unalias_type(arg_types[0]);
+    switch (arg_type.typesiganture_kind()) {
+        case TypeSignatureBody::Kind::pointer_type:  return { any_first_argument_category, "pointer", "slice", "string" };
+        case TypeSignatureBody::Kind::array_type:    return { any_first_argument_category, "array" };
+        case TypeSignatureBody::Kind::slice_type:    return { any_first_argument_category, "slice", "string" };
+        case TypeSignatureBody::Kind::template_type: return { };
+        case TypeSignatureBody::Kind::inline_union:  return { };
+        case TypeSignatureBody::Kind::primitive_type: {
+            const std::string& type_name = arg_type.get<PrimitiveType>().type_name;
+            if (type_name == int_type || type_name == int32_type) {
+                return { any_first_argument_category, "string", "primitive:" + int_type, "primitive:" + int32_type };
+            }
+            return { any_first_argument_category, "string", "primitive:" + type_name };
+        }
+        case TypeSignatureBody::Kind::custom_type: {
+            const std::string& type_name = arg_type.get<CustomType>().type_name;
+            return { any_first_argument_category, "custom:" + type_name };
+        }
+    }
+    assert_unreachable();
+}
\ No newline at end of file
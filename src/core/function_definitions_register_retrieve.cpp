@@ -11,14 +11,17 @@
 #include "core/generics_instantiation_engine.hpp"
 #include "preprocessing/preprocessor.hpp"
 #include "core/assignment_type_checker.hpp"
+#include "misc/compilation_statistics.hpp"
 
 FunctionDefinition::Ref FunctionDefinitionsRegister::retrieve_function_definition(
     const FunctionCall& function_call,
     const std::vector<TypeSignature>& arg_types
 ) {
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::overload_resolutions);
     std::string cache_key = get_cache_search_key_for_func_def_retrieval_from_func_call(type_definitions_register, function_call, arg_types);
     auto cache_search_outcome = fast_retrieve_cache.find(cache_key);
     if (cache_search_outcome != fast_retrieve_cache.end()) {
+        CompilationStatistics::increment_counter(CompilationStatistics::Counter::fast_retrieve_cache_hits);
         return cache_search_outcome->second;
     }
     FunctionDefinition::Ref func_def_ref = cache_unaware_function_definition_retrieval(function_call, arg_types);
@@ -31,26 +34,21 @@ FunctionDefinitionsRegister::search_for_best_matches(
     const FunctionCall& function_call,
     const std::vector<TypeSignature>& arg_types
 ) {
-    std::vector<std::string> candidate_overload_set_ids = retrieve_overload_sets_ids(function_call);
-    std::vector<std::pair<FunctionDefinition::Ref, GenericSubstitutionRule::Set::Ref>> best_maches_so_far; 
+    std::vector<OverloadCandidate> candidates = collect_overload_candidates(function_call, arg_types);
+    std::vector<MatchedFunctionData> best_maches_so_far; 
     FunctionSpecificityDescriptor best_specificity_so_far = FunctionSpecificityDescriptor::worst_possible_specificity();
-    for (const std::string& overload_set_id : candidate_overload_set_ids) {
-        std::vector<FunctionDefinition::Ref>& current_overload_set = retrieve_specific_overload_set(overload_set_id);
-        for (const FunctionDefinition::Ref& func_def_ref : current_overload_set) {
-            FunctionSpecificityDescriptor current_specificity(*func_def_ref, type_definitions_register);
-            FunctionSpecificityDescriptor::ComparisonResult comparison_result = current_specificity.compare_with(best_specificity_so_far);
-            bool is_less_specific = comparison_result == FunctionSpecificityDescriptor::ComparisonResult::less_specific;
-            GenericSubstitutionRule::Set::Ref generic_substitution_rules_ref = check_function_compatibility(func_def_ref, function_call, arg_types);
-            bool should_be_ignored = is_less_specific || generic_substitution_rules_ref == nullptr;
-            if (should_be_ignored) {
-                continue;
-            }
-            best_maches_so_far.push_back({ func_def_ref, generic_substitution_rules_ref });
-            if (comparison_result == FunctionSpecificityDescriptor::ComparisonResult::more_specific) {
-                best_maches_so_far = { { func_def_ref, generic_substitution_rules_ref } };
-                best_specificity_so_far = current_specificity;
-            }
+    for (const OverloadCandidate& candidate : candidates) {
+        FunctionSpecificityDescriptor::ComparisonResult comparison_result = candidate.specificity.compare_with(best_specificity_so_far);
+        if (!best_maches_so_far.empty() && comparison_result == FunctionSpecificityDescriptor::ComparisonResult::less_specific) {
+            break;
         }
+        const FunctionDefinition::Ref& func_def_ref = candidate.function_definition_ref;
+        GenericSubstitutionRule::Set::Ref generic_substitution_rules_ref = check_function_compatibility(func_def_ref, function_call, arg_types);
+        if (generic_substitution_rules_ref == nullptr) {
+            continue;
+        }
+        best_maches_so_far.push_back({ func_def_ref, generic_substitution_rules_ref });
+        best_specificity_so_far = candidate.specificity;
     }
     return best_maches_so_far;
 }
@@ -84,11 +82,45 @@ FunctionDefinition::Ref FunctionDefinitionsRegister::cache_unaware_function_defi
         return best_match;
     }
     const GenericSubstitutionRule::Set::Ref generic_substitution_rules = best_maches_so_far[0].second;
-    const std::string new_function_name = get_new_instantiated_function_name(*best_match, generic_substitution_rules);
+    return retrieve_or_instantiate_generic_function(best_match, generic_substitution_rules);
+}
+
+std::string FunctionDefinitionsRegister::get_canonical_generic_substitution_key(
+    const FunctionDefinition& generic_function_definition,
+    GenericSubstitutionRule::Set::Ref generic_substitution_rules
+) {
+    std::string canonical_key;
+    for (const std::string& template_generic_name : generic_function_definition.template_generics_names) {
+        for (const GenericSubstitutionRule& rule : *generic_substitution_rules) {
+            if (rule.to_be_replaced == template_generic_name) {
+                canonical_key += std::to_string(type_definitions_register.get_typesignature_id(rule.replacement));
+                break;
+            }
+        }
+        canonical_key += ";";
+    }
+    return canonical_key;
+}
+
+FunctionDefinition::Ref FunctionDefinitionsRegister::retrieve_or_instantiate_generic_function(
+    const FunctionDefinition::Ref& generic_function_definition,
+    GenericSubstitutionRule::Set::Ref generic_substitution_rules
+) {
+    std::unordered_map<std::string, FunctionDefinition::Ref>& instantiations = 
+        generic_instantiations_table[generic_function_definition.get()];
+    std::string canonical_key = get_canonical_generic_substitution_key(*generic_function_definition, generic_substitution_rules);
+    auto table_search_outcome = instantiations.find(canonical_key);
+    if (table_search_outcome != instantiations.end()) {
+        CompilationStatistics::increment_counter(CompilationStatistics::Counter::instantiation_table_hits);
+        return table_search_outcome->second;
+    }
+    const std::string new_function_name = get_new_instantiated_function_name(*generic_function_definition, generic_substitution_rules);
     GenericsInstantiationEngine generics_instantiation_engine(*generic_substitution_rules);
     FunctionDefinition::Ref instanitated_func_def_ref = 
-        generics_instantiation_engine.instantiate_generic_function(best_match, new_function_name);
+        generics_instantiation_engine.instantiate_generic_function(generic_function_definition, new_function_name);
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::generic_instantiations);
     function_definitions.push_back(instanitated_func_def_ref);
+    instantiations.insert({canonical_key, instanitated_func_def_ref});
     return instanitated_func_def_ref;
 }
 
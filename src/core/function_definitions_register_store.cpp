@@ -18,9 +18,11 @@ void FunctionDefinitionsRegister::store_function_definition(
     function_definitions.push_back(func_def_ref);
     const std::string overload_set_id = get_function_definition_overload_set_id(package_name, func_def_ref);
     function_definitions_overload_sets[overload_set_id].push_back(func_def_ref);
+    function_definitions_overload_sets_indexes.erase(overload_set_id);
     if (!func_def.template_generics_names.empty()) {
         const std::string generics_unaware_overload_set_id = get_generics_unaware_function_definition_overload_set_id(package_name, func_def_ref);
         function_definitions_overload_sets[generics_unaware_overload_set_id].push_back(func_def_ref);
+        function_definitions_overload_sets_indexes.erase(generics_unaware_overload_set_id);
     }
 }
 
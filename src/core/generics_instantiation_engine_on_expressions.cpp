@@ -8,6 +8,9 @@
 #include "errors/internal_errors.hpp"
 
 Expression GenericsInstantiationEngine::instantiate_generic_expression(const Expression& expression) {
+    if (!expression.is_generic()) {
+        return expression;
+    }
     switch (expression.expression_kind()) {
         case ExpressionBody::Kind::function_call:         return instantiate_generic_function_call(expression.get<FunctionCall>());
         case ExpressionBody::Kind::binary_operator:       return instantiate_generic_binary_operator(expression.get<BinaryOperator>());
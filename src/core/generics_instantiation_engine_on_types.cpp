@@ -9,6 +9,9 @@
 #include "errors/internal_errors.hpp"
 
 TypeSignature GenericsInstantiationEngine::instantiate_generic_typesignature(const TypeSignature& type_signature) {
+    if (!type_signature.is_generic()) {
+        return type_signature;
+    }
     switch (type_signature.typesiganture_kind()) {
         case TypeSignatureBody::Kind::template_type:  return instantiate_template_type(type_signature.get<TemplateType>());
         case TypeSignatureBody::Kind::custom_type:    return instantiate_custom_type(type_signature.get<CustomType>());
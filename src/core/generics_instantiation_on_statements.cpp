@@ -9,6 +9,9 @@
 #include "errors/internal_errors.hpp"
 
 Statement GenericsInstantiationEngine::instantiate_generic_statement(const Statement& statement) {
+    if (!statement.is_generic()) {
+        return statement;
+    }
     switch (statement.statement_kind()) {
         case StatementBody::Kind::function_call: return instantiate_generic_function_call(statement.get<FunctionCall>());
         case StatementBody::Kind::variable_declaration: return instantiate_generic_variable_declaration(statement.get<VariableDeclaration>()); 
@@ -17,7 +20,7 @@ Statement GenericsInstantiationEngine::instantiate_generic_statement(const State
         case StatementBody::Kind::conditional: return instantiate_generic_conditional(statement.get<Conditional>());
         case StatementBody::Kind::while_loop: return instantiate_generic_while_loop(statement.get<WhileLoop>());
         case StatementBody::Kind::until_loop: return instantiate_generic_until_loop(statement.get<UntilLoop>());
-        case StatementBody::Kind::return_statement: return statement;
+        case StatementBody::Kind::return_statement: return instantiate_generic_return_statement(statement.get<Return>());
         case StatementBody::Kind::continue_statement: return statement;
         case StatementBody::Kind::break_statement: return statement;
     }
@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "core/interned_types_table.hpp"
+#include "syntax/specials.hpp"
+#include "errors/internal_errors.hpp"
+
+TypeId InternedTypesTable::intern_fully_qualified_name(const std::string& fully_qualified_name) {
+    auto search_outcome = type_ids_by_fully_qualified_name.find(fully_qualified_name);
+    if (search_outcome != type_ids_by_fully_qualified_name.end()) {
+        return search_outcome->second;
+    }
+    TypeId type_id = static_cast<TypeId>(fully_qualified_names.size());
+    fully_qualified_names.push_back(fully_qualified_name);
+    type_ids_by_fully_qualified_name.insert({fully_qualified_name, type_id});
+    return type_id;
+}
+
+std::optional<TypeId> InternedTypesTable::search_fully_qualified_name(const std::string& fully_qualified_name) const {
+    auto search_outcome = type_ids_by_fully_qualified_name.find(fully_qualified_name);
+    if (search_outcome != type_ids_by_fully_qualified_name.end()) {
+        return search_outcome->second;
+    }
+    return std::nullopt;
+}
+
+const std::string& InternedTypesTable::get_fully_qualified_name(TypeId type_id) const {
+    return fully_qualified_names.at(type_id);
+}
+
+TypeId InternedTypesTable::intern_composite_type(
+    TypeSignatureBody::Kind kind, 
+    size_t array_length, 
+    std::vector<TypeId> components
+) {
+    CompositeTypeKey composite_type_key { kind, array_length, std::move(components) };
+    auto search_outcome = type_ids_by_composite_key.find(composite_type_key);
+    if (search_outcome != type_ids_by_composite_key.end()) {
+        return search_outcome->second;
+    }
+    std::string fully_qualified_name = build_composite_type_fully_qualified_name(composite_type_key);
+    TypeId type_id = intern_fully_qualified_name(fully_qualified_name);
+    type_ids_by_composite_key.insert({std::move(composite_type_key), type_id});
+    return type_id;
+}
+
+size_t InternedTypesTable::CompositeTypeKeyHash::operator()(const CompositeTypeKey& composite_type_key) const {
+    size_t hash = std::hash<size_t>()(static_cast<size_t>(composite_type_key.kind));
+    hash ^= std::hash<size_t>()(composite_type_key.array_length) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    for (TypeId component : composite_type_key.components) {
+        hash ^= std::hash<TypeId>()(component) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+std::string InternedTypesTable::build_composite_type_fully_qualified_name(const CompositeTypeKey& composite_type_key) const {
+    const std::vector<TypeId>& components = composite_type_key.components;
+    switch (composite_type_key.kind) {
+        case TypeSignatureBody::Kind::slice_type: {
+            return slice_type_symbol + get_fully_qualified_name(components.front());
+        }
+        case TypeSignatureBody::Kind::pointer_type: {
+            return pointer_type_symbol + get_fully_qualified_name(components.front());
+        }
+        case TypeSignatureBody::Kind::array_type: {
+            std::string array_size_section = "[" + std::to_string(composite_type_key.array_length) + "]";
+            return array_size_section + get_fully_qualified_name(components.front());
+        }
+        case TypeSignatureBody::Kind::inline_union: {
+            std::string inline_union_fully_qualified_name;
+            for (TypeId alternative : components) {
+                if (!inline_union_fully_qualified_name.empty()) {
+                    inline_union_fully_qualified_name += " | ";
+                }
+                inline_union_fully_qualified_name += get_fully_qualified_name(alternative);
+            }
+            return inline_union_fully_qualified_name;
+        }
+        default: assert_unreachable();
+    }
+}
\ No newline at end of file
@@ -39,6 +39,17 @@ std::optional<TypeSignature> ProgramRepresentation::resolve_expression_type(
     ).deduce_expression_type(expression);
 }
 
+ScopeContext ProgramRepresentation::create_function_scope_context(
+    const FunctionDefinition& function_definition
+) {
+    auto search_outcome = typed_expressions_tables.find(&function_definition);
+    if (search_outcome == typed_expressions_tables.end()) {
+        auto typed_expressions_table = std::make_shared<TypedExpressionsTable>();
+        search_outcome = typed_expressions_tables.insert({&function_definition, typed_expressions_table}).first;
+    }
+    return ScopeContext(function_definition, search_outcome->second);
+}
+
 void ProgramRepresentation::foreach_type_definition(
     std::function<void(const TypeDefinition&)> functor
 ) {
@@ -93,6 +104,30 @@ std::string ProgramRepresentation::get_fully_qualified_typedefinition_name(
     return type_definitions_register.get_fully_qualified_typedefinition_name(type_definition);
 }
 
+TypeId ProgramRepresentation::get_typesignature_id(
+    const TypeSignature& typesignature
+) {
+    return type_definitions_register.get_typesignature_id(typesignature);
+}
+
+TypeId ProgramRepresentation::get_typedefinition_id(
+    const TypeDefinition& type_definition
+) {
+    return type_definitions_register.get_typedefinition_id(type_definition);
+}
+
+TypeId ProgramRepresentation::get_fully_qualified_name_id(
+    const std::string& fully_qualified_name
+) {
+    return type_definitions_register.get_fully_qualified_name_id(fully_qualified_name);
+}
+
+const std::string& ProgramRepresentation::get_fully_qualified_name(
+    TypeId type_id
+) {
+    return type_definitions_register.get_fully_qualified_name(type_id);
+}
+
 std::list<FileRepresentation>& ProgramRepresentation::get_files_by_package(
     const std::string& package_name
 ) {
@@ -117,13 +152,13 @@ bool ProgramRepresentation::is_union(
     return type_definitions_register.is_union(maybe_union_type);
 }
 
-std::vector<TypeSignature> ProgramRepresentation::fetch_union_alternatives(
+const std::vector<TypeSignature>& ProgramRepresentation::fetch_union_alternatives(
     const TypeSignature& maybe_union_type
 ) {
     return type_definitions_register.fetch_union_alternatives(maybe_union_type);
 }
 
-std::vector<TypeSignature> ProgramRepresentation::fetch_non_union_compatible_types_for_union_assignment(
+const std::vector<TypeSignature>& ProgramRepresentation::fetch_non_union_compatible_types_for_union_assignment(
     const TypeSignature& maybe_union_type
 ) {
     return type_definitions_register.fetch_non_union_compatible_types_for_union_assignment(maybe_union_type);
@@ -168,13 +203,7 @@ CallableCodeBlock ProgramRepresentation::resolve_function_call(
         project_file_structure,
         scope_context
     );
-    FunctionCallResolver function_call_resolver(
-        type_definitions_register,
-        function_definitions_register,
-        common_feature_adoption_plan_generation_engine
-    );
-    auto arg_types = expression_type_deducer.deduce_argument_types_from_function_call(function_call);
-    return function_call_resolver.resolve_function_call(function_call, arg_types);
+    return expression_type_deducer.resolve_function_call(function_call);
 }
 
 DotMemberAccess ProgramRepresentation::normalize_dot_member_access(
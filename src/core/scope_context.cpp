@@ -4,13 +4,26 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "core/scope_context.hpp"
+#include "core/typed_expressions_table.hpp"
 #include "errors/preprocessing_errors.hpp"
 
-ScopeContext::ScopeContext(const FunctionDefinition& function_definition) {
+ScopeContext::ScopeContext()
+    : symbol_table(std::make_shared<ScopeSymbolTable>())
+{}
+
+ScopeContext::ScopeContext(const FunctionDefinition& function_definition)
+    : ScopeContext(function_definition, std::make_shared<TypedExpressionsTable>())
+{}
+
+ScopeContext::ScopeContext(
+    const FunctionDefinition& function_definition, 
+    const std::shared_ptr<TypedExpressionsTable>& typed_expressions_table
+)
+    : symbol_table(std::make_shared<ScopeSymbolTable>())
+    , typed_expressions_table(typed_expressions_table)
+{
     for (const FunctionDefinition::Argument& argument : function_definition.arguments) {
-        std::string unique_scope_insensitive_id = function_definition.unique_string_id() + "/ARG:" + argument.arg_name;
-        local_objects.push_back({
-            .unique_scope_insensitive_id = unique_scope_insensitive_id,
+        store_local_object({
             .identifier = argument.arg_name,
             .type_signature = argument.arg_type,
             .is_const = false,
@@ -19,11 +32,20 @@ ScopeContext::ScopeContext(const FunctionDefinition& function_definition) {
     }
 }
 
+ScopeContext::ScopeContext(
+    const std::shared_ptr<ScopeSymbolTable>& symbol_table,
+    ScopeSymbolTable::ScopeId scope_id,
+    const std::shared_ptr<TypedExpressionsTable>& typed_expressions_table
+)
+    : symbol_table(symbol_table)
+    , scope_id(scope_id)
+    , typed_expressions_table(typed_expressions_table)
+{}
+
 void ScopeContext::store_local_variable(const VariableDeclaration& var_declaration) {
     bool search_outcome = contains(var_declaration.identifier_name);
     ensure_identifier_not_ambiguous_in_given_scope(var_declaration.identifier_name, search_outcome);
-    local_objects.push_back({
-        .unique_scope_insensitive_id = var_declaration.as_debug_informations_aware_entity().unique_string_id(),
+    store_local_object({
         .identifier = var_declaration.identifier_name,
         .type_signature = var_declaration.typesignature,
         .is_const = false,
@@ -34,8 +56,7 @@ void ScopeContext::store_local_variable(const VariableDeclaration& var_declarati
 void ScopeContext::store_local_constant(const ConstDeclaration& const_declaration) {
     bool search_outcome = contains(const_declaration.identifier_name);
     ensure_identifier_not_ambiguous_in_given_scope(const_declaration.identifier_name, search_outcome);
-    local_objects.push_back({
-        .unique_scope_insensitive_id = const_declaration.as_debug_informations_aware_entity().unique_string_id(),
+    store_local_object({
         .identifier = const_declaration.identifier_name,
         .type_signature = const_declaration.typesignature,
         .is_const = true,
@@ -43,6 +64,10 @@ void ScopeContext::store_local_constant(const ConstDeclaration& const_declaratio
     });
 }
 
+void ScopeContext::store_local_object(const ScopeSymbolTable::LocalObject& local_object) {
+    symbol_table->store_local_object(scope_id, local_object);
+}
+
 bool ScopeContext::contains(const std::string& identifier) {
     MaybeObjectRef retrieved = retrieve(identifier);
     return retrieved.has_value();
@@ -59,24 +84,27 @@ TypeSignature& ScopeContext::get_local_object_type(const std::string& identifier
     return retrieved->get().type_signature;
 }
 
-std::string ScopeContext::resolve_object_unique_id(const std::string& identifier) {
-    MaybeObjectRef retrieved = retrieve(identifier);
-    return retrieved->get().unique_scope_insensitive_id;
+ScopeSymbolTable::SlotId ScopeContext::resolve_object_slot_id(const std::string& identifier) {
+    std::optional<ScopeSymbolTable::SlotId> slot_id = symbol_table->lookup(scope_id, identifier);
+    ensure_parent_scope_exists_for_further_local_object_search(slot_id.has_value(), identifier);
+    return slot_id.value();
 }
 
 ScopeContext::MaybeObjectRef ScopeContext::retrieve(const std::string& identifier) {
-    for (ObjectDescriptor& object : local_objects) {
-        if (object.identifier == identifier) {
-            return std::ref(object);
-        }
+    std::optional<ScopeSymbolTable::SlotId> slot_id = symbol_table->lookup(scope_id, identifier);
+    return (slot_id.has_value())
+        ? MaybeObjectRef(std::ref(symbol_table->get_local_object(slot_id.value())))
+        : std::nullopt;
+}
+
+TypedExpressionsTable& ScopeContext::get_typed_expressions_table() {
+    if (typed_expressions_table == nullptr) {
+        typed_expressions_table = std::make_shared<TypedExpressionsTable>();
     }
-    return (parent_scope == nullptr)
-        ? std::nullopt
-        : parent_scope->retrieve(identifier);
+    return *typed_expressions_table;
 }
 
 ScopeContext ScopeContext::create_nested_scope() {
-    ScopeContext nested_scope;
-    nested_scope.parent_scope = this;
-    return nested_scope;
+    ScopeSymbolTable::ScopeId nested_scope_id = symbol_table->create_nested_scope(scope_id);
+    return ScopeContext(symbol_table, nested_scope_id, typed_expressions_table);
 }
\ No newline at end of file
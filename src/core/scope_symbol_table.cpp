@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "core/scope_symbol_table.hpp"
+
+ScopeSymbolTable::ScopeSymbolTable() {
+    scopes.push_back(ScopeFrame { .parent_scope_id = no_scope, .depth = 0 });
+    active_scopes_stack.push_back(root_scope_id);
+}
+
+ScopeSymbolTable::ScopeId ScopeSymbolTable::create_nested_scope(ScopeId parent_scope_id) {
+    ScopeId nested_scope_id = scopes.size();
+    scopes.push_back(ScopeFrame { 
+        .parent_scope_id = parent_scope_id, 
+        .depth = scopes[parent_scope_id].depth + 1 
+    });
+    return nested_scope_id;
+}
+
+ScopeSymbolTable::SlotId ScopeSymbolTable::store_local_object(ScopeId scope_id, const LocalObject& local_object) {
+    activate_scope(scope_id);
+    SlotId slot_id = local_objects.size();
+    local_objects.push_back(local_object);
+    slots_identifiers.push_back(intern_identifier(local_object.identifier));
+    scopes[scope_id].declared_slots.push_back(slot_id);
+    bind_slot_in_active_scope(scope_id, slot_id);
+    return slot_id;
+}
+
+std::optional<ScopeSymbolTable::SlotId> ScopeSymbolTable::lookup(ScopeId scope_id, const std::string& identifier) {
+    auto interned_search_outcome = interned_identifiers.find(identifier);
+    if (interned_search_outcome == interned_identifiers.end()) {
+        return std::nullopt;
+    }
+    activate_scope(scope_id);
+    SlotId slot_id = visible_bindings[interned_search_outcome->second];
+    return (slot_id == no_slot) ? std::nullopt : std::optional<SlotId>(slot_id);
+}
+
+ScopeSymbolTable::LocalObject& ScopeSymbolTable::get_local_object(SlotId slot_id) {
+    return local_objects[slot_id];
+}
+
+ScopeSymbolTable::IdentifierId ScopeSymbolTable::intern_identifier(const std::string& identifier) {
+    auto [interned, inserted] = interned_identifiers.insert({ identifier, visible_bindings.size() });
+    if (inserted) {
+        visible_bindings.push_back(no_slot);
+    }
+    return interned->second;
+}
+
+bool ScopeSymbolTable::is_ancestor_or_self(ScopeId candidate_ancestor_id, ScopeId scope_id) const {
+    size_t candidate_ancestor_depth = scopes[candidate_ancestor_id].depth;
+    while (scope_id != no_scope && scopes[scope_id].depth > candidate_ancestor_depth) {
+        scope_id = scopes[scope_id].parent_scope_id;
+    }
+    return scope_id == candidate_ancestor_id;
+}
+
+void ScopeSymbolTable::activate_scope(ScopeId scope_id) {
+    if (active_scopes_stack.back() == scope_id) {
+        return;
+    }
+    while (!active_scopes_stack.empty() && !is_ancestor_or_self(active_scopes_stack.back(), scope_id)) {
+        pop_scope();
+    }
+    std::vector<ScopeId> scopes_to_enter;
+    for (ScopeId current = scope_id; current != no_scope; current = scopes[current].parent_scope_id) {
+        if (!active_scopes_stack.empty() && active_scopes_stack.back() == current) {
+            break;
+        }
+        scopes_to_enter.push_back(current);
+    }
+    for (auto scope_iterator = scopes_to_enter.rbegin(); scope_iterator != scopes_to_enter.rend(); ++scope_iterator) {
+        push_scope(*scope_iterator);
+    }
+}
+
+void ScopeSymbolTable::bind_slot_in_active_scope(ScopeId scope_id, SlotId slot_id) {
+    IdentifierId identifier_id = slots_identifiers[slot_id];
+    scopes[scope_id].undo_log.push_back({ identifier_id, visible_bindings[identifier_id] });
+    visible_bindings[identifier_id] = slot_id;
+}
+
+void ScopeSymbolTable::push_scope(ScopeId scope_id) {
+    active_scopes_stack.push_back(scope_id);
+    for (SlotId slot_id : scopes[scope_id].declared_slots) {
+        bind_slot_in_active_scope(scope_id, slot_id);
+    }
+}
+
+void ScopeSymbolTable::pop_scope() {
+    ScopeFrame& scope_frame = scopes[active_scopes_stack.back()];
+    for (auto undo_iterator = scope_frame.undo_log.rbegin(); undo_iterator != scope_frame.undo_log.rend(); ++undo_iterator) {
+        visible_bindings[undo_iterator->first] = undo_iterator->second;
+    }
+    scope_frame.undo_log.clear();
+    active_scopes_stack.pop_back();
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "language/statements.hpp"
+
+static bool any_statement_is_generic(const std::vector<Statement>& statements) {
+    for (const Statement& statement : statements) {
+        if (statement.is_generic()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Statement::is_generic() const {
+    return generic_bit;
+}
+
+bool VariableDeclaration::is_generic() const {
+    return typesignature.is_generic() || (initial_value.has_value() && initial_value->is_generic());
+}
+
+bool ConstDeclaration::is_generic() const {
+    return typesignature.is_generic() || value.is_generic();
+}
+
+bool Assignment::is_generic() const {
+    return assignment_target.is_generic() || assigned_value.is_generic();
+}
+
+bool Conditional::is_generic() const {
+    return condition.is_generic() || any_statement_is_generic(then_branch) || any_statement_is_generic(else_branch);
+}
+
+bool WhileLoop::is_generic() const {
+    return condition.is_generic() || any_statement_is_generic(loop_body);
+}
+
+bool UntilLoop::is_generic() const {
+    return condition.is_generic() || any_statement_is_generic(loop_body);
+}
+
+bool Return::is_generic() const {
+    return return_value.has_value() && return_value->is_generic();
+}
+
+bool Continue::is_generic() const {
+    return false;
+}
+
+bool Break::is_generic() const {
+    return false;
+}
\ No newline at end of file
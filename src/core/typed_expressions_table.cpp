@@ -0,0 +1,47 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "core/typed_expressions_table.hpp"
+#include "errors/internal_errors.hpp"
+
+// Entries are keyed by the address of the expression body, and each entry keeps
+// its own copy of the expression: the body can't be freed (and its address reused
+// by another node) for as long as the table is alive.
+
+bool TypedExpressionsTable::contains_expression_type(const Expression& expression) const {
+    return expression_types.find(&expression.as_expression_body()) != expression_types.end();
+}
+
+const std::optional<TypeSignature>& 
+TypedExpressionsTable::get_expression_type(const Expression& expression) const {
+    auto search_outcome = expression_types.find(&expression.as_expression_body());
+    assert_typed_expression_was_found(search_outcome != expression_types.end());
+    return search_outcome->second.type_signature;
+}
+
+void TypedExpressionsTable::store_expression_type(
+    const Expression& expression, 
+    const std::optional<TypeSignature>& type_signature
+) {
+    const ExpressionBody* expression_body = &expression.as_expression_body();
+    expression_types.insert({expression_body, TypedExpression { expression, type_signature }});
+}
+
+std::optional<CallableCodeBlock> 
+TypedExpressionsTable::search_resolved_function_call(const FunctionCall& function_call) const {
+    auto search_outcome = resolved_function_calls.find(static_cast<const ExpressionBody*>(&function_call));
+    if (search_outcome != resolved_function_calls.end()) {
+        return search_outcome->second.callable_code_block;
+    }
+    return std::nullopt;
+}
+
+void TypedExpressionsTable::store_resolved_function_call(
+    const Expression& expression, 
+    const CallableCodeBlock& callable_code_block
+) {
+    const ExpressionBody* expression_body = &expression.as_expression_body();
+    resolved_function_calls.insert({expression_body, ResolvedFunctionCall { expression, callable_code_block }});
+}
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "errors/preprocessing_errors.hpp"
 #include "errors/internal_errors.hpp"
 #include "core/generics_substitution_rules.hpp"
+#include "misc/compilation_statistics.hpp"
 
 std::string TypeDefinitionsRegister::get_fully_qualified_customtype_name(const CustomType& type_signature) {
     if (!type_signature.package_prefix.empty()) {
@@ -38,47 +39,79 @@ std::string TypeDefinitionsRegister::get_fully_qualified_typedefinition_name(con
 }
 
 std::string TypeDefinitionsRegister::get_fully_qualified_typesignature_name(const TypeSignature& type_signature) {
+    return get_fully_qualified_name(get_typesignature_id(type_signature));
+}
+
+TypeId TypeDefinitionsRegister::get_typesignature_id(const TypeSignature& type_signature) {
     switch (type_signature.typesiganture_kind()) {
         case TypeSignatureBody::Kind::slice_type: {
-            return "$" + get_fully_qualified_typesignature_name(type_signature.get<SliceType>().stored_type);
+            TypeId stored_type_id = get_typesignature_id(type_signature.get<SliceType>().stored_type);
+            return interned_types_table.intern_composite_type(TypeSignatureBody::Kind::slice_type, 0, { stored_type_id });
         }
         case TypeSignatureBody::Kind::pointer_type: {
-            return "#" + get_fully_qualified_typesignature_name(type_signature.get<PointerType>().pointed_type);
+            TypeId pointed_type_id = get_typesignature_id(type_signature.get<PointerType>().pointed_type);
+            return interned_types_table.intern_composite_type(TypeSignatureBody::Kind::pointer_type, 0, { pointed_type_id });
         }
         case TypeSignatureBody::Kind::array_type: {
-            const TypeSignature& stored_type = type_signature.get<ArrayType>().stored_type;
             const ArrayType& array_type = type_signature.get<ArrayType>();
-            std::string array_size_section = "[" + std::to_string(array_type.array_length) + "]";
-            return array_size_section + get_fully_qualified_typesignature_name(stored_type);
+            TypeId stored_type_id = get_typesignature_id(array_type.stored_type);
+            return interned_types_table.intern_composite_type(TypeSignatureBody::Kind::array_type, array_type.array_length, { stored_type_id });
         }
-        case TypeSignatureBody::Kind::primitive_type: return type_signature.get<PrimitiveType>().type_name;
-        case TypeSignatureBody::Kind::template_type: return type_signature.get<TemplateType>().type_name;
-        case TypeSignatureBody::Kind::custom_type: return get_fully_qualified_customtype_name(type_signature.get<CustomType>());    
+        case TypeSignatureBody::Kind::primitive_type: return get_fully_qualified_name_id(type_signature.get<PrimitiveType>().type_name);
+        case TypeSignatureBody::Kind::template_type: return get_fully_qualified_name_id(type_signature.get<TemplateType>().type_name);
+        case TypeSignatureBody::Kind::custom_type: return get_customtype_id(type_signature.get<CustomType>());    
         case TypeSignatureBody::Kind::inline_union: {
-            std::string inline_union_fully_qualified_name;
+            std::vector<TypeId> alternatives_ids;
             for (const TypeSignature& alternative : type_signature.get<InlineUnion>().alternatives) {
-                inline_union_fully_qualified_name += get_fully_qualified_typesignature_name(alternative) + " | ";
+                alternatives_ids.push_back(get_typesignature_id(alternative));
             }
-            inline_union_fully_qualified_name.pop_back();
-            inline_union_fully_qualified_name.pop_back();
-            inline_union_fully_qualified_name.pop_back();
-            return inline_union_fully_qualified_name;
+            return interned_types_table.intern_composite_type(TypeSignatureBody::Kind::inline_union, 0, std::move(alternatives_ids));
         }
     }
     assert_unreachable();
 }
 
+TypeId TypeDefinitionsRegister::get_customtype_id(const CustomType& type_signature) {
+    if (!type_signature.type_parameters.empty()) {
+        return get_fully_qualified_name_id(get_fully_qualified_customtype_name(type_signature));
+    }
+    std::unordered_map<std::string, TypeId>& resolved_in_file_with_prefix = 
+        resolved_customtype_ids[type_signature.filename][type_signature.package_prefix];
+    auto search_outcome = resolved_in_file_with_prefix.find(type_signature.type_name);
+    if (search_outcome != resolved_in_file_with_prefix.end()) {
+        return search_outcome->second;
+    }
+    TypeId type_id = get_fully_qualified_name_id(get_fully_qualified_customtype_name(type_signature));
+    resolved_in_file_with_prefix.insert({type_signature.type_name, type_id});
+    return type_id;
+}
+
+TypeId TypeDefinitionsRegister::get_typedefinition_id(const TypeDefinition& type_definition) {
+    return get_fully_qualified_name_id(get_fully_qualified_typedefinition_name(type_definition));
+}
+
+TypeId TypeDefinitionsRegister::get_fully_qualified_name_id(const std::string& fully_qualified_name) {
+    return interned_types_table.intern_fully_qualified_name(fully_qualified_name);
+}
+
+const std::string& TypeDefinitionsRegister::get_fully_qualified_name(TypeId type_id) {
+    return interned_types_table.get_fully_qualified_name(type_id);
+}
+
 std::optional<std::string> TypeDefinitionsRegister::search_fully_qualified_typesignature_name(
     const CustomType& type_signature, 
     const std::string& package_name
 ) {
     std::string instantiated_concrete_type_key = infer_possible_fully_qualified_typesignature_name(package_name, type_signature);
-    auto retrieved = type_definitions.find(instantiated_concrete_type_key);
-    if (retrieved != type_definitions.end()) {
+    std::optional<TypeId> instantiated_concrete_type_id = interned_types_table.search_fully_qualified_name(instantiated_concrete_type_key);
+    if (instantiated_concrete_type_id.has_value() && type_definitions.find(*instantiated_concrete_type_id) != type_definitions.end()) {
         return instantiated_concrete_type_key;
     }
     const std::string template_generic_type_key = get_type_signature_match_pattern(package_name, type_signature);
-    retrieved = type_definitions.find(template_generic_type_key);
+    std::optional<TypeId> template_generic_type_id = interned_types_table.search_fully_qualified_name(template_generic_type_key);
+    auto retrieved = (template_generic_type_id.has_value())
+        ? type_definitions.find(*template_generic_type_id) 
+        : type_definitions.end();
     if (retrieved == type_definitions.end()) {
         return std::nullopt;
     }
@@ -92,7 +125,8 @@ std::optional<std::string> TypeDefinitionsRegister::search_fully_qualified_types
         std::regex package_prefix("(.*?::)+");
         std::string new_name = std::regex_replace(instantiated_concrete_type_key, package_prefix, "");
         TypeDefinition instantiated = generic_instantiation_engine.instantiate_generic_typedefinition(to_be_instantiated, new_name);
-        type_definitions.insert({instantiated_concrete_type_key, instantiated});
+        CompilationStatistics::increment_counter(CompilationStatistics::Counter::generic_instantiations);
+        type_definitions.insert({get_fully_qualified_name_id(instantiated_concrete_type_key), instantiated});
         return instantiated_concrete_type_key;
     }
 }
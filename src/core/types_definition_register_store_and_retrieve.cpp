@@ -21,7 +21,7 @@ TypeDefinitionsRegister::TypeDefinitionsRegister(ProjectFileStructure& project_f
 void TypeDefinitionsRegister::foreach_type_definition(
     std::function<void(const TypeDefinition&)> visitor
 ) {
-    for (const std::string& type_definition_id : type_definitions_ids) {
+    for (TypeId type_definition_id : type_definitions_ids) {
         const TypeDefinition& type_definition = type_definitions.at(type_definition_id);
         visitor(type_definition);
     }
@@ -44,15 +44,16 @@ void TypeDefinitionsRegister::verify_that_the_type_exists(const TypeSignature& t
 }
 
 void TypeDefinitionsRegister::store_type_definition(const TypeDefinition& type_def) {
-    const std::string match_pattern = get_fully_qualified_typedefinition_name(type_def);
-    const auto& insertion_outcome = type_definitions.insert({match_pattern, type_def});
+    const TypeId match_pattern_id = get_typedefinition_id(type_def);
+    const auto& insertion_outcome = type_definitions.insert({match_pattern_id, type_def});
     ensure_no_multiple_definition_of_the_same_type(insertion_outcome);
-    type_definitions_ids.push_back(match_pattern);
+    type_definitions_ids.push_back(match_pattern_id);
+    resolved_customtype_ids.clear();
 }
 
 TypeDefinition TypeDefinitionsRegister::retrieve_type_definition(const CustomType& type_signature) {
-    const std::string fully_qualified_name = get_fully_qualified_customtype_name(type_signature);
-    auto search_outcome = type_definitions.find(fully_qualified_name);
+    const TypeId fully_qualified_name_id = get_customtype_id(type_signature);
+    auto search_outcome = type_definitions.find(fully_qualified_name_id);
     if (search_outcome != type_definitions.end()) {
         return search_outcome->second;
     }
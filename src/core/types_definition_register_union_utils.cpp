@@ -8,33 +8,79 @@
 #include "errors/internal_errors.hpp"
 #include "core/generics_substitution_rules.hpp"
 
+static constexpr size_t bits_per_bitset_word = 64;
+
+static void set_type_id_in_bitset(std::vector<uint64_t>& bitset, TypeId type_id) {
+    const size_t word_index = type_id / bits_per_bitset_word;
+    if (word_index >= bitset.size()) {
+        bitset.resize(word_index + 1, 0);
+    }
+    bitset[word_index] |= (uint64_t(1) << (type_id % bits_per_bitset_word));
+}
+
+static bool test_type_id_in_bitset(const std::vector<uint64_t>& bitset, TypeId type_id) {
+    const size_t word_index = type_id / bits_per_bitset_word;
+    return word_index < bitset.size() && 
+        (bitset[word_index] & (uint64_t(1) << (type_id % bits_per_bitset_word))) != 0;
+}
+
+static void merge_bitsets(std::vector<uint64_t>& destination, const std::vector<uint64_t>& source) {
+    if (source.size() > destination.size()) {
+        destination.resize(source.size(), 0);
+    }
+    for (size_t word_index = 0; word_index < source.size(); word_index++) {
+        destination[word_index] |= source[word_index];
+    }
+}
+
 bool TypeDefinitionsRegister::is_union(
     const TypeSignature& maybe_union_type
 ) {
-    return !fetch_union_alternatives(maybe_union_type).empty();
+    return retrieve_union_closure(maybe_union_type).is_union;
 }
 
-std::vector<TypeSignature> TypeDefinitionsRegister::fetch_union_alternatives(
-    const TypeSignature& maybe_union_type
+bool TypeDefinitionsRegister::is_union_member(
+    const TypeSignature& union_type, 
+    const TypeSignature& candidate_member
 ) {
-    const TypeSignature& unaliased_maybe_union_type = unalias_type(maybe_union_type);
-    if (unaliased_maybe_union_type.is<CustomType>()) {
-        CustomType custom_type = unaliased_maybe_union_type.get<CustomType>();
-        TypeDefinition type_definition = retrieve_type_definition(custom_type);
-        return (type_definition.is<UnionDefinition>())
-            ? type_definition.get<UnionDefinition>().types
-            : std::vector<TypeSignature>();
+    const UnionClosure& union_closure = retrieve_union_closure(union_type);
+    if (union_closure.contains_generics || candidate_member.is_generic()) {
+        return false;
     }
-    return (unaliased_maybe_union_type.is<InlineUnion>())
-        ? unaliased_maybe_union_type.get<InlineUnion>().alternatives
-        : std::vector<TypeSignature>();
+    const TypeId candidate_member_id = get_typesignature_id(unalias_type(candidate_member));
+    return test_type_id_in_bitset(union_closure.flattened_alternatives_ids_bitset, candidate_member_id);
 }
 
-std::vector<TypeSignature> TypeDefinitionsRegister::fetch_non_union_compatible_types_for_union_assignment(
+bool TypeDefinitionsRegister::is_union_subset(
+    const TypeSignature& sub_union_type, 
+    const TypeSignature& super_union_type
+) {
+    const UnionClosure& sub_union_closure = retrieve_union_closure(sub_union_type);
+    const UnionClosure& super_union_closure = retrieve_union_closure(super_union_type);
+    if (!sub_union_closure.is_union || sub_union_closure.contains_generics || super_union_closure.contains_generics) {
+        return false;
+    }
+    const std::vector<uint64_t>& sub_bitset = sub_union_closure.flattened_alternatives_ids_bitset;
+    const std::vector<uint64_t>& super_bitset = super_union_closure.flattened_alternatives_ids_bitset;
+    for (size_t word_index = 0; word_index < sub_bitset.size(); word_index++) {
+        const uint64_t super_word = (word_index < super_bitset.size()) ? super_bitset[word_index] : 0;
+        if ((sub_bitset[word_index] & ~super_word) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const std::vector<TypeSignature>& TypeDefinitionsRegister::fetch_union_alternatives(
     const TypeSignature& maybe_union_type
 ) {
-    std::vector<TypeSignature> alternatives = fetch_union_alternatives(maybe_union_type);
-    return fetch_non_union_compatible_types_for_union_assignment(alternatives);
+    return retrieve_union_closure(maybe_union_type).alternatives;
+}
+
+const std::vector<TypeSignature>& TypeDefinitionsRegister::fetch_non_union_compatible_types_for_union_assignment(
+    const TypeSignature& maybe_union_type
+) {
+    return retrieve_union_closure(maybe_union_type).flattened_alternatives;
 }
 
 std::vector<TypeSignature> TypeDefinitionsRegister::fetch_non_union_compatible_types_for_union_assignment(
@@ -48,13 +94,68 @@ std::vector<TypeSignature> TypeDefinitionsRegister::fetch_non_union_compatible_t
 ) {
     std::vector<TypeSignature> compatible_types;
     for (const TypeSignature& alternative : alternatives) {
-        std::vector<TypeSignature> sub_alternatives = fetch_union_alternatives(alternative);
-        if (sub_alternatives.empty()) {
+        const UnionClosure& alternative_closure = retrieve_union_closure(alternative);
+        if (!alternative_closure.is_union) {
             compatible_types.push_back(alternative);
             continue;
         } 
-        std::vector<TypeSignature> sub_compatible_types = fetch_non_union_compatible_types_for_union_assignment(alternative);
+        const std::vector<TypeSignature>& sub_compatible_types = alternative_closure.flattened_alternatives;
         compatible_types.insert(compatible_types.end(), sub_compatible_types.begin(), sub_compatible_types.end());
     }
     return compatible_types;
+}
+
+const TypeDefinitionsRegister::UnionClosure& TypeDefinitionsRegister::retrieve_union_closure(
+    const TypeSignature& maybe_union_type
+) {
+    const TypeId type_id = get_typesignature_id(maybe_union_type);
+    auto search_outcome = union_closures.find(type_id);
+    if (search_outcome != union_closures.end()) {
+        return search_outcome->second;
+    }
+    UnionClosure union_closure;
+    union_closure.alternatives = compute_union_alternatives(maybe_union_type);
+    union_closure.is_union = !union_closure.alternatives.empty();
+    for (const TypeSignature& alternative : union_closure.alternatives) {
+        const UnionClosure& alternative_closure = retrieve_union_closure(alternative);
+        if (!alternative_closure.is_union) {
+            add_flattened_alternative_to_union_closure(union_closure, alternative);
+            continue;
+        }
+        const std::vector<TypeSignature>& sub_alternatives = alternative_closure.flattened_alternatives;
+        union_closure.flattened_alternatives.insert(union_closure.flattened_alternatives.end(), sub_alternatives.begin(), sub_alternatives.end());
+        union_closure.contains_generics |= alternative_closure.contains_generics;
+        merge_bitsets(union_closure.flattened_alternatives_ids_bitset, alternative_closure.flattened_alternatives_ids_bitset);
+    }
+    return union_closures.insert({type_id, std::move(union_closure)}).first->second;
+}
+
+void TypeDefinitionsRegister::add_flattened_alternative_to_union_closure(
+    UnionClosure& union_closure, 
+    const TypeSignature& alternative
+) {
+    union_closure.flattened_alternatives.push_back(alternative);
+    const TypeSignature unaliased_alternative = unalias_type(alternative);
+    if (unaliased_alternative.is_generic()) {
+        union_closure.contains_generics = true;
+        return;
+    }
+    set_type_id_in_bitset(union_closure.flattened_alternatives_ids_bitset, get_typesignature_id(alternative));
+    set_type_id_in_bitset(union_closure.flattened_alternatives_ids_bitset, get_typesignature_id(unaliased_alternative));
+}
+
+std::vector<TypeSignature> TypeDefinitionsRegister::compute_union_alternatives(
+    const TypeSignature& maybe_union_type
+) {
+    const TypeSignature& unaliased_maybe_union_type = unalias_type(maybe_union_type);
+    if (unaliased_maybe_union_type.is<CustomType>()) {
+        CustomType custom_type = unaliased_maybe_union_type.get<CustomType>();
+        TypeDefinition type_definition = retrieve_type_definition(custom_type);
+        return (type_definition.is<UnionDefinition>())
+            ? type_definition.get<UnionDefinition>().types
+            : std::vector<TypeSignature>();
+    }
+    return (unaliased_maybe_union_type.is<InlineUnion>())
+        ? unaliased_maybe_union_type.get<InlineUnion>().alternatives
+        : std::vector<TypeSignature>();
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 #include "errors/internal_errors.hpp"
 
 bool TypeSignature::is_generic() const {
-    return ptr->is_generic();
+    return generic_bit;
 }
 
 bool CustomType::is_generic() const {
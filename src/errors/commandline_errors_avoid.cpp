@@ -55,4 +55,43 @@ void avoid_lack_of_target_triple(const std::optional<std::string>& target_triple
             "(target triple is supposed to be specified right after the -t flag)"
         );
     }
+}
+
+void avoid_lack_of_target_cpu(const std::optional<std::string>& target_cpu) {
+    if (!target_cpu.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "no target cpu specified, don't know what to do \n"
+            "(target cpu is supposed to be specified right after the --cpu flag \n"
+            "and can be either `native` or the name of a processor)"
+        );
+    }
+}
+
+void avoid_lack_of_jobs_count(const std::optional<std::string>& jobs_count) {
+    if (!jobs_count.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "no number of jobs specified, don't know what to do \n"
+            "(the number of jobs is supposed to be specified right after the -j flag)"
+        );
+    }
+}
+
+void avoid_lack_of_time_trace_file(const std::optional<std::string>& time_trace_file) {
+    if (!time_trace_file.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "no time trace file specified, don't know what to do \n"
+            "(the time trace file is supposed to be specified right after the --time-trace flag \n"
+            "and will be overwritten with a Chrome trace-event JSON document)"
+        );
+    }
+}
+
+void avoid_lack_of_target_features(const std::optional<std::string>& target_features) {
+    if (!target_features.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "no target features specified, don't know what to do \n"
+            "(target features are supposed to be specified right after the --features flag \n"
+            "as a comma-separated list like +avx2,+bmi2,-sse4a)"
+        );
+    }
 }
\ No newline at end of file
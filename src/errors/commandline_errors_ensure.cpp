@@ -23,6 +23,42 @@ void ensure_lack_of_target_triple(const std::optional<std::string>& target_tripl
     }
 }
 
+void ensure_lack_of_target_cpu(const std::optional<std::string>& target_cpu) {
+    if (target_cpu.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "target cpu was given but it wasn't needed, \n"
+            "(please run `basalt help` for more info)"
+        );
+    }
+}
+
+void ensure_lack_of_target_features(const std::optional<std::string>& target_features) {
+    if (target_features.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "target features were given but they weren't needed, \n"
+            "(please run `basalt help` for more info)"
+        );
+    }
+}
+
+void ensure_lack_of_optimization_level(const std::optional<OptimizationLevel>& optimization_level) {
+    if (optimization_level.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "optimization level was given but it wasn't needed, \n"
+            "(please run `basalt help` for more info)"
+        );
+    }
+}
+
+void ensure_lack_of_jobs_count(const std::optional<size_t>& jobs_count) {
+    if (jobs_count.has_value()) {
+        CompilationError::raise<CommandLineError>(
+            "number of jobs was given but it wasn't needed, \n"
+            "(please run `basalt help` for more info)"
+        );
+    }
+}
+
 void ensure_lack_of_output_files(const std::vector<std::string>& output_files) {
     if (!output_files.empty()) {
         CompilationError::raise<CommandLineError>(
@@ -51,10 +87,47 @@ void ensure_source_file_is_open(const std::fstream& input_file, const std::strin
     }
 }
 
+void ensure_time_trace_file_is_open(const std::ofstream& time_trace_file, const std::string& file_name) {
+    if (!time_trace_file.is_open()) {
+        CompilationError::raise<CommandLineError>(
+            "time trace file " + file_name + " cannot be opened for writing \n"
+            "(please make sure the directory exists and is writable)"
+        );
+    }
+}
+
+void ensure_source_file_is_mapped(bool is_mapped, const std::string& file_name) {
+    if (!is_mapped) {
+        CompilationError::raise<CommandLineError>(
+            "file " + file_name + " either is missing or is inaccessible \n"
+            "(please double-check the name of the file and make sure the \n"
+            "path to that file is fully and correctly specified)"
+        );
+    }
+}
+
 void ensure_valid_target_triple(const std::string& target_triple, const std::string& error) {
     if (!error.empty()) {
         CompilationError::raise<CommandLineError>(
             "target triple " + target_triple + " is invalid:\n" + error
         );
     }
+}
+
+void ensure_valid_target_cpu(const std::string& target_cpu, const std::string& target_triple, bool is_valid) {
+    if (!is_valid) {
+        CompilationError::raise<CommandLineError>(
+            "target cpu " + target_cpu + " is not a recognized processor "
+            "for the target triple " + target_triple
+        );
+    }
+}
+
+void ensure_main_function_is_defined_for_jit_execution(bool main_function_is_defined) {
+    if (!main_function_is_defined) {
+        CompilationError::raise<CommandLineError>(
+            "the `run` subcommand requires the program to define \n"
+            "a `main` function inside of the `main` package"
+        );
+    }
 }
\ No newline at end of file
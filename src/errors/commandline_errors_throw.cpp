@@ -44,4 +44,18 @@ void throw_unrecognized_file_extension(const std::string& filename) {
     CompilationError::raise<CommandLineError>( 
         "unrecognized file extension for file: " + filename
     );
+}
+
+void throw_unrecognized_optimization_level(const std::string& flag) {
+    CompilationError::raise<CommandLineError>( 
+        "unrecognized optimization level: " + flag + " \n"
+        "(the only supported optimization levels are -O0, -O1, -O2, -O3, -Os)"
+    );
+}
+
+void throw_invalid_jobs_count(const std::string& jobs_count) {
+    CompilationError::raise<CommandLineError>( 
+        "invalid number of jobs: " + jobs_count + " \n"
+        "(the number of jobs must be a positive integer, e.g. -j 8)"
+    );
 }
\ No newline at end of file
@@ -0,0 +1,27 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "errors/internal_errors.hpp"
+
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/Error.h>
+
+void assert_llvm_module_is_well_formed(const llvm::Module& llvm_module) {
+    if (llvm::verifyModule(llvm_module, &llvm::errs())) {
+        throw std::runtime_error {
+            "the generated llvm-ir is malformed, hence it cannot be optimized"
+        };
+    }
+}
+
+void assert_llvm_jit_operation_succeeded(llvm::Error&& llvm_error) {
+    if (llvm_error) {
+        throw std::runtime_error {
+            "the jit failed to execute the program: " + llvm::toString(std::move(llvm_error))
+        };
+    }
+}
\ No newline at end of file
@@ -10,12 +10,12 @@
         "an execution path that should have been unreachable has been reached! (assert_unreachable)"
     };
 }
-void assert_get_operation_is_possible(const char* wanted_type, const std::type_info& type_info) {
+void assert_get_operation_is_possible(bool is_operation_possible, const std::type_info& type_info) {
     #ifdef DEBUG_BUILD
-    if (wanted_type != type_info.name()) {
+    if (!is_operation_possible) {
         throw std::runtime_error {
-            "an attempt has been made to cast something that was holding " 
-            "the type: " + std::string(type_info.name()) + " to the type: " + wanted_type
+            "an attempt has been made to cast something to the type: " + 
+            std::string(type_info.name()) + " while it was holding a node of a different kind"
         };
     }
     #endif
@@ -29,7 +29,7 @@ void assert_token_matches(
 }
 
 void assert_token_is_of_given_type(
-    const std::vector<Token> source_tokens,
+    const std::vector<Token>& source_tokens,
     const std::vector<Token>::iterator& iterator, 
     const std::string& expected_type_str,
     const Token::Type expected_type
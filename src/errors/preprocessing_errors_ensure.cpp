@@ -31,7 +31,7 @@ void ensure_character_literal_has_exactly_one_character(
 }
 
 void ensure_no_multiple_definition_of_the_same_type(
-    const std::pair<std::unordered_map<std::string, TypeDefinition>::iterator, bool>& 
+    const std::pair<std::unordered_map<TypeId, TypeDefinition>::iterator, bool>& 
         type_definition_insertion_outcome
 ) {
     if (!(type_definition_insertion_outcome.second)) {
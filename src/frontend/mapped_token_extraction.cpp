@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <array>
+
+#include "errors/tokenization_errors.hpp"
+#include "frontend/mapped_tokenizer.hpp"
+#include "syntax/symbols.hpp"
+
+static bool is_symbol_character(char character) {
+    static const std::array<bool, 256> symbol_characters_table = [](){
+        std::array<bool, 256> table {};
+        for (char symbol_character : symbols) {
+            table[static_cast<unsigned char>(symbol_character)] = true;
+        }
+        return table;
+    }();
+    return symbol_characters_table[static_cast<unsigned char>(character)];
+}
+
+static bool is_digit_character(char character) {
+    return isdigit(static_cast<unsigned char>(character));
+}
+
+static bool is_alpha_character(char character) {
+    return isalpha(static_cast<unsigned char>(character));
+}
+
+std::optional<TokenView> MappedTokenizer::extract_number() {
+    if (!is_digit_character(current_line[char_pos])) {
+        return std::nullopt;
+    }
+    bool floating = false;
+    size_t number_end = char_pos;
+    for (; number_end < current_line.size(); number_end++) {
+        char current_character = current_line[number_end];
+        if (!is_digit_character(current_character) && current_character != '.') {
+            break;
+        }
+        if (floating && current_character == '.') {
+            avoid_multiple_floating_points(floating, current_character, make_coordinates());
+        }
+        floating = floating || (current_character == '.');
+    }
+    Token::Type type = (floating)
+        ? Token::Type::floating_literal 
+        : Token::Type::integer_literal;
+    return make_token_view(current_line.substr(char_pos, number_end - char_pos), type);
+}
+
+std::optional<TokenView> MappedTokenizer::extract_text() {
+    if (!is_alpha_character(current_line[char_pos])) {
+        return std::nullopt;
+    }
+    size_t text_end = char_pos;
+    for (; text_end < current_line.size(); text_end++) {
+        char current_character = current_line[text_end];
+        if (!is_alpha_character(current_character) && !is_digit_character(current_character) && current_character != '_') break;
+    }
+    std::string_view text = current_line.substr(char_pos, text_end - char_pos);
+    return make_token_view(text, get_textual_token_type(text));
+}
+
+std::optional<TokenView> MappedTokenizer::extract_string() {
+    char opening_character = current_line[char_pos];
+    if (string_opening_characters.find(opening_character) == string_opening_characters.end()) {
+        return std::nullopt;
+    }
+    bool escape = false;
+    size_t string_end = char_pos + 1;
+    for (size_t i = char_pos + 1; i < current_line.size(); i++) {
+        string_end = i + 1;
+        if (current_line[i] == opening_character && !escape) {
+            break;
+        }
+        escape = (current_line[i] == '\\') && !escape;
+    }
+    std::string_view string_literal = current_line.substr(char_pos, string_end - char_pos);
+    if (string_literal.front() != string_literal.back()) {
+        ensure_string_gets_closed(std::string(string_literal), make_coordinates());
+    }
+    Token::Type type = (opening_character == '\'')
+        ? Token::Type::character_literal 
+        : Token::Type::string_literal;
+    return make_token_view(string_literal, type);
+}
+
+std::optional<TokenView> MappedTokenizer::extract_symbol() {
+    size_t i = char_pos, j = char_pos + 1;
+    Token::Type type = Token::Type::symbol;
+    if(i >= current_line.size() || !is_symbol_character(current_line[i])) return std::nullopt;
+    if(j >= current_line.size() || !is_symbol_character(current_line[j])) return make_token_view(current_line.substr(i, 1), type);
+    if(combinations.find({current_line[i],current_line[j]}) == combinations.end()) return make_token_view(current_line.substr(i, 1), type);
+    return make_token_view(current_line.substr(i, 2), type);
+}
+
+std::optional<TokenView> MappedTokenizer::extract() {
+    handle_multiline_comments();
+    handle_simple_comments();
+    ignore_discardable_characters();
+    if (char_pos >= current_line.size()) {
+        return std::nullopt;
+    }
+    std::optional<TokenView> extracted; 
+    if ((extracted = extract_text()).has_value())    return extracted;
+    if ((extracted = extract_symbol()).has_value())  return extracted;
+    if ((extracted = extract_number()).has_value())  return extracted;
+    if ((extracted = extract_string()).has_value())  return extracted;
+    inspect_for_unexpected_tokens();
+    return std::nullopt;
+}
\ No newline at end of file
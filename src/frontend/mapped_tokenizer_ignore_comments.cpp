@@ -0,0 +1,49 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "frontend/mapped_tokenizer.hpp"
+#include "syntax/specials.hpp"
+
+void MappedTokenizer::update_multiline_comments_tracker() {
+    if (char_pos + 1 < current_line.size()) {
+        if (current_line[char_pos] == multiline_comment_opening[0] && current_line[char_pos+1] == multiline_comment_opening[1]) {
+            char_pos = char_pos + 2;
+            multiline_comments_tracker.push_back(make_token_view(multiline_comment_opening, Token::Type::multiline_comment));
+        }
+    }
+}
+
+void MappedTokenizer::ignore_multiline_comments() {
+    while (!multiline_comments_tracker.empty() && char_pos < current_line.size()) {
+        if (char_pos + 1 < current_line.size()) {
+            std::string_view maybe_comment_sequence = current_line.substr(char_pos, 2);
+            if (maybe_comment_sequence == multiline_comment_opening) {
+                char_pos = char_pos + 2;
+                TokenView comment_token = make_token_view(multiline_comment_opening, Token::Type::multiline_comment);
+                multiline_comments_tracker.push_back(comment_token);
+                continue;
+            }
+            else if (maybe_comment_sequence == multiline_comment_closing) {
+                char_pos = char_pos + 2;
+                multiline_comments_tracker.pop_back();
+                continue;
+            }
+        }
+        char_pos = char_pos + 1;
+    }
+}
+
+void MappedTokenizer::handle_multiline_comments() {
+    update_multiline_comments_tracker();
+    ignore_multiline_comments();
+}
+
+void MappedTokenizer::handle_simple_comments() {
+    if (char_pos + 1 < current_line.size()) {
+        if (current_line[char_pos] == single_line_comment[0] && current_line[char_pos+1] == single_line_comment[1]) {
+            char_pos = current_line.size();
+        }
+    }
+}
\ No newline at end of file
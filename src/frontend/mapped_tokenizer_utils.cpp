@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <array>
+#include <algorithm>
+
+#include "syntax/keywords.hpp"
+#include "syntax/specials.hpp"
+#include "errors/tokenization_errors.hpp"
+#include "frontend/mapped_tokenizer.hpp"
+#include "misc/compilation_statistics.hpp"
+
+static bool is_discardable_character(char character) {
+    static const std::array<bool, 256> discardable_characters_table = [](){
+        std::array<bool, 256> table {};
+        for (char discardable_character : discardable) {
+            table[static_cast<unsigned char>(discardable_character)] = true;
+        }
+        return table;
+    }();
+    return discardable_characters_table[static_cast<unsigned char>(character)];
+}
+
+static size_t get_longest_keyword_length() {
+    static const size_t longest_keyword_length = [](){
+        size_t longest = 0;
+        for (const auto& [keyword, keyword_type] : keywords) {
+            longest = std::max(longest, keyword.size());
+        }
+        return longest;
+    }();
+    return longest_keyword_length;
+}
+
+Token TokenView::to_token(const SourceFilesRegistry& source_files_registry) const {
+    return Token {
+        std::string(sourcetext), 
+        source_files_registry.get_filename(file_id), 
+        line_number, tok_number, char_pos,
+        type
+    };
+}
+
+MappedTokenizer::MappedTokenizer(SourceFilesRegistry& source_files_registry, SourceFilesRegistry::FileId file_id)
+    : source_files_registry(source_files_registry)
+    , file_id(file_id)
+    , source_text(source_files_registry.get_source_text(file_id)) {}
+
+void MappedTokenizer::inspect_for_unexpected_tokens() {
+    size_t unexpected_token_begin = char_pos;
+    while (char_pos < current_line.size() && !is_discardable_character(current_line[char_pos])) {
+        char_pos = char_pos + 1;
+    }
+    if (char_pos > unexpected_token_begin) {
+        std::string_view unexpected_token = current_line.substr(unexpected_token_begin, char_pos - unexpected_token_begin);
+        char_pos = char_pos - 1;
+        throw_unexpected_token(make_token_view(unexpected_token, Token::Type::text).to_token(source_files_registry));
+    }
+}
+
+void MappedTokenizer::ignore_discardable_characters() {
+    while (char_pos < current_line.size() && is_discardable_character(current_line[char_pos])) {
+        char_pos = char_pos + 1;
+    }
+}
+
+TokenView MappedTokenizer::make_token_view(std::string_view sourcetext, const Token::Type token_type) {
+    return TokenView {
+        sourcetext, file_id, line_number, tok_number,
+        static_cast<uint32_t>(char_pos - sourcetext.size() + 1),
+        token_type
+    };
+}
+
+DebugInformationsAwareEntity MappedTokenizer::make_coordinates() {
+    return DebugInformationsAwareEntity { 
+        source_files_registry.get_filename(file_id),
+        line_number, 
+        tok_number,
+        static_cast<unsigned int>(char_pos),
+    };
+}
+
+Token::Type MappedTokenizer::get_textual_token_type(std::string_view sourcetext) {
+    if (sourcetext == "true" || sourcetext == "false") return Token::Type::boolean_literal;
+    if (isupper(static_cast<unsigned char>(sourcetext[0]))) return Token::Type::type;
+    if (sourcetext.size() > get_longest_keyword_length()) return Token::Type::text;
+    auto keyword_search_outcome = keywords.find(std::string(sourcetext));
+    auto not_found = keywords.end();
+    return (keyword_search_outcome != not_found)?  
+        keyword_search_outcome->second : Token::Type::text;
+}
+
+std::vector<TokenView> MappedTokenizer::tokenize_as_views() {
+    std::vector<TokenView> tokens;
+    size_t line_begin = 0;
+    while (line_begin < source_text.size()) {
+        size_t line_end = std::min(source_text.find('\n', line_begin), source_text.size());
+        current_line = source_text.substr(line_begin, line_end - line_begin);
+        line_begin = line_end + 1;
+        line_number = line_number + 1;
+        tok_number = 0;
+        char_pos = 0;
+        while (char_pos < current_line.size()) {
+            ignore_discardable_characters();
+            std::optional<TokenView> token = extract();
+            if (token.has_value()) {
+                tokens.push_back(*token);
+            }
+            tok_number += (token.has_value() && token->type != Token::Type::multiline_comment);
+            char_pos += ( (token.has_value())? token->sourcetext.size() : 0 );
+        }
+    }
+    if (!multiline_comments_tracker.empty()) {
+        std::stack<Token> unclosed_multiline_comments;
+        unclosed_multiline_comments.push(multiline_comments_tracker.back().to_token(source_files_registry));
+        ensure_multiline_comments_get_closed(unclosed_multiline_comments, make_coordinates());
+    }
+    return tokens;
+}
+
+TokenizedFile MappedTokenizer::tokenize() {
+    TokenizedFile tokenized_file;
+    tokenized_file.filename = source_files_registry.get_filename(file_id);
+    std::vector<TokenView> token_views = tokenize_as_views();
+    tokenized_file.tokens.reserve(token_views.size());
+    for (const TokenView& token_view : token_views) {
+        tokenized_file.tokens.push_back(token_view.to_token(source_files_registry));
+    }
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::tokens, tokenized_file.tokens.size());
+    return tokenized_file;
+}
\ No newline at end of file
@@ -23,7 +23,7 @@ static std::string resolve_escaped_characters(const Token& token) {
             resolved_string.push_back(current_char);
             continue;
         } 
-        assert(i + 1 >= end);
+        assert(i + 1 < end);
         char next_char = source_string[++i];
         switch (next_char) {
             break; case 'n':  resolved_string.push_back('\n');
@@ -5,6 +5,7 @@
 
 #include "syntax/specials.hpp"
 #include "syntax/infixes.hpp"
+#include "syntax/prefixes.hpp"
 #include "errors/internal_errors.hpp"
 #include "errors/parsing_errors.hpp"
 #include "frontend/parser.hpp"
@@ -70,9 +71,9 @@ Expression Parser::parse_terminal_expression() {
 
 Expression Parser::parse_text_first_expression() {
     Expression identifier = parse_identifier();
-    bool should_stop_here = std::next(iterator) == source_tokens.end();
+    bool should_stop_here = iterator == source_tokens.end();
     should_stop_here = should_stop_here || std::next(iterator) == source_tokens.end();
-    should_stop_here |= !function_call_opening_characters.contains(iterator->sourcetext);
+    should_stop_here = should_stop_here || !function_call_opening_characters.contains(iterator->sourcetext);
     if (should_stop_here) {
         return identifier;
     }
@@ -88,25 +89,47 @@ Expression Parser::parse_text_first_expression() {
 Expression Parser::parse_symbol_first_expression() {
     if (iterator->sourcetext == "(") return parse_expression_wrapped_in_parenthesis(); 
     else if (iterator->sourcetext == "[") return parse_array_literal();
-    else return parse_prefix_operator();
+    else if (prefixes.contains(iterator->sourcetext)) return parse_prefix_operator();
+    else throw_expression_expected_got_unrecognized(iterator);
 }
 
 Expression Parser::parse_prefix_operator() {
     assert_token_is_prefix_operator(iterator);
     const Token& operator_token = *iterator;
+    short operator_priority = prefix_operators_priority.find(operator_token.sourcetext)->second;
     std::advance(iterator, 1);
-    Expression operand = parse_terminal_expression();
+    Expression operand = parse_expression_with_minimum_priority(operator_priority + 1);
     return UnaryOperator { operator_token, operand };
 }
 
 Expression Parser::parse_expression() {
+    Expression expression = parse_expression_with_minimum_priority(0);
+    if (!expression_ended()) {
+        throw_expression_expected_got_unrecognized(iterator);
+    }
+    return expression;
+}
+
+// precedence climbing: every binary operator whose priority is at least `minimum_priority` is
+// folded left-associatively into the expression, while its right operand only gets to absorb 
+// strictly higher priority operators. The AST is thus built in its final shape in a single pass.
+Expression Parser::parse_expression_with_minimum_priority(short minimum_priority) {
+    Expression expression = parse_operand_expression();
+    while (is_binary_operator() && infix_operators_priority.find(iterator->sourcetext)->second >= minimum_priority) {
+        expression = compose_binary_operator(expression);
+    }
+    return expression;
+}
+
+// postfix operators bind tighter than any prefix or binary operator, hence they are 
+// applied directly to the terminal they follow (so that `-a.b` means `-(a.b)`).
+Expression Parser::parse_operand_expression() {
     Expression expression = parse_terminal_expression();
-    while(!expression_ended()) {
+    while (!expression_ended()) {
         if (is_dot_member_access())    expression = compose_dot_member_access(expression);
-        else if (is_binary_operator()) expression = compose_binary_operator(expression);
         else if (is_square_bracket())  expression = compose_square_bracket_access(expression);
         else if (is_type_operator())   expression = compose_type_operator(expression);
-        else                           throw_expression_expected_got_unrecognized(iterator);
+        else                           break;
     }
     return expression;
 }
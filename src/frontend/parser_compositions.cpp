@@ -7,6 +7,7 @@
 #include "errors/parsing_errors.hpp"
 #include "frontend/parser.hpp"
 #include "language/expressions.hpp"
+#include "syntax/infixes.hpp"
 
 Expression Parser::compose_dot_member_access(const Expression& left_operand) {
     assert_token_matches(source_tokens, iterator, ".");
@@ -15,24 +16,22 @@ Expression Parser::compose_dot_member_access(const Expression& left_operand) {
     assert_identifier_is_properly_formatted(iterator);
     const std::string& member_name = iterator->sourcetext;
     std::advance(iterator, 1);
-    DotMemberAccess dot_member_access { operator_token, left_operand, member_name };
-    return rotate_to_match_dot_member_access_priority(dot_member_access);
+    return DotMemberAccess { operator_token, left_operand, member_name };
 }
 
 Expression Parser::compose_binary_operator(const Expression& left_operand) {
     assert_token_is_binary_operator(iterator);
     const Token& operator_token = *(iterator++);
-    Expression right_operand = parse_terminal_expression();
-    BinaryOperator binary_operator{ operator_token, left_operand, right_operand };
-    return rotate_binary_operator_to_match_operators_priority(binary_operator);
+    short operator_priority = infix_operators_priority.find(operator_token.sourcetext)->second;
+    Expression right_operand = parse_expression_with_minimum_priority(operator_priority + 1);
+    return BinaryOperator { operator_token, left_operand, right_operand };
 }
 
 Expression Parser::compose_square_bracket_access(const Expression& left_operand) {
     assert_token_matches(source_tokens, iterator, "[");
     const Token& open_bracket_token = *iterator;
     Expression index_expression = parse_expression_wrapped_in_square_brackets();
-    SquareBracketsAccess square_brackets_access { open_bracket_token, left_operand, index_expression };
-    return rotate_to_match_square_brackets_access_priority(square_brackets_access);
+    return SquareBracketsAccess { open_bracket_token, left_operand, index_expression };
 }
 
 Expression Parser::compose_type_operator(const Expression& expression) {
@@ -40,6 +39,5 @@ Expression Parser::compose_type_operator(const Expression& expression) {
     const Token& operator_token = *iterator;
     std::advance(iterator, 1);
     TypeSignature typesignature = parse_typesignature();
-    TypeOperator is_operator { operator_token, expression, typesignature };
-    return rotate_to_match_type_operator_priority(is_operator);
+    return TypeOperator { operator_token, expression, typesignature };
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "frontend/source_files_registry.hpp"
+#include "errors/commandline_errors.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+MappedSourceFile::MappedSourceFile(const std::string& file_path)
+    : filename(file_path)
+{
+    #ifndef _WIN32
+        int file_descriptor = open(file_path.c_str(), O_RDONLY);
+        ensure_source_file_is_mapped(file_descriptor >= 0, file_path);
+        struct stat file_status;
+        bool file_status_is_known = fstat(file_descriptor, &file_status) == 0;
+        if (file_status_is_known && file_status.st_size > 0) {
+            void* mapping = mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if (mapping != MAP_FAILED) {
+                mapped_address = static_cast<const char*>(mapping);
+                mapped_size = file_status.st_size;
+            }
+        }
+        close(file_descriptor);
+        ensure_source_file_is_mapped(file_status_is_known, file_path);
+        if (mapped_address != nullptr || file_status.st_size == 0) {
+            return;
+        }
+    #endif
+    std::ifstream input_file(file_path, std::ios::in | std::ios::binary);
+    ensure_source_file_is_mapped(input_file.is_open(), file_path);
+    std::ostringstream file_content;
+    file_content << input_file.rdbuf();
+    owned_source_text = file_content.str();
+}
+
+MappedSourceFile::MappedSourceFile(const std::string& inline_input_name, std::string inline_input_text)
+    : filename(inline_input_name)
+    , owned_source_text(std::move(inline_input_text))
+{ }
+
+MappedSourceFile::~MappedSourceFile() {
+    #ifndef _WIN32
+        if (mapped_address != nullptr) {
+            munmap(const_cast<char*>(mapped_address), mapped_size);
+        }
+    #endif
+}
+
+std::string_view MappedSourceFile::get_source_text() const {
+    return (mapped_address != nullptr)
+        ? std::string_view(mapped_address, mapped_size)
+        : std::string_view(owned_source_text);
+}
+
+const std::string& MappedSourceFile::get_filename() const {
+    return filename;
+}
+
+SourceFilesRegistry::FileId SourceFilesRegistry::map_source_file(const std::string& file_path) {
+    source_files.push_back(std::make_unique<MappedSourceFile>(file_path));
+    return static_cast<FileId>(source_files.size() - 1);
+}
+
+SourceFilesRegistry::FileId SourceFilesRegistry::store_inline_input(
+    const std::string& inline_input_name, 
+    std::string inline_input_text
+) {
+    source_files.push_back(std::make_unique<MappedSourceFile>(inline_input_name, std::move(inline_input_text)));
+    return static_cast<FileId>(source_files.size() - 1);
+}
+
+std::string_view SourceFilesRegistry::get_source_text(FileId file_id) const {
+    return source_files.at(file_id)->get_source_text();
+}
+
+const std::string& SourceFilesRegistry::get_filename(FileId file_id) const {
+    return source_files.at(file_id)->get_filename();
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "misc/ast_arena.hpp"
+#include "misc/compilation_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+
+thread_local AstArena::Shard* AstArena::current_shard = nullptr;
+
+AstArena::~AstArena() {
+    for (auto shard = shards.rbegin(); shard != shards.rend(); shard++) {
+        std::vector<NodeDestructor>& node_destructors = (*shard)->node_destructors;
+        for (auto destructor = node_destructors.rbegin(); destructor != node_destructors.rend(); destructor++) {
+            destructor->destroy(destructor->node);
+        }
+    }
+}
+
+bool AstArena::is_in_use_by_current_thread() {
+    return current_shard != nullptr;
+}
+
+size_t AstArena::get_reserved_bytes() {
+    std::lock_guard<std::mutex> lock(shards_mutex);
+    size_t reserved_bytes = 0;
+    for (const std::unique_ptr<Shard>& shard : shards) {
+        reserved_bytes += shard->reserved_bytes;
+    }
+    return reserved_bytes;
+}
+
+void* AstArena::Shard::allocate_bytes(size_t size, size_t alignment) {
+    void* cursor = chunk_cursor;
+    size_t available_space = chunk_end - chunk_cursor;
+    if (cursor == nullptr || std::align(alignment, size, cursor, available_space) == nullptr) {
+        size_t new_chunk_size = std::max(chunk_size, size + alignment);
+        chunks.push_back(std::unique_ptr<std::byte[]>(new std::byte[new_chunk_size]));
+        reserved_bytes += new_chunk_size;
+        CompilationStatistics::increment_counter(CompilationStatistics::Counter::ast_arena_bytes, new_chunk_size);
+        cursor = chunks.back().get();
+        available_space = new_chunk_size;
+        std::align(alignment, size, cursor, available_space);
+    }
+    chunk_cursor = static_cast<std::byte*>(cursor) + size;
+    chunk_end = chunk_cursor + (available_space - size);
+    return cursor;
+}
+
+AstArena::Scope::Scope(AstArena& arena)
+    : previous_shard(current_shard)
+{
+    std::lock_guard<std::mutex> lock(arena.shards_mutex);
+    arena.shards.push_back(std::make_unique<Shard>());
+    current_shard = arena.shards.back().get();
+}
+
+AstArena::Scope::~Scope() {
+    current_shard = previous_shard;
+}
\ No newline at end of file
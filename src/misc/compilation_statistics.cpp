@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// AUTHOR: Francesco De Rosa (https://github.com/fDero)                    //
+// LICENSE: MIT (https://github.com/fDero/Basalt/blob/master/LICENSE)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "misc/compilation_statistics.hpp"
+#include "errors/internal_errors.hpp"
+
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct TimedPhase {
+    std::string phase_name;
+    std::string detail;
+    std::chrono::steady_clock::time_point start_instant;
+    std::chrono::steady_clock::time_point end_instant;
+    size_t thread_index;
+};
+
+std::array<std::atomic<size_t>, static_cast<size_t>(CompilationStatistics::Counter::counters_count)> 
+    CompilationStatistics::counters {};
+
+static const std::chrono::steady_clock::time_point process_startup_instant = std::chrono::steady_clock::now();
+static std::mutex timed_phases_mutex;
+static std::vector<TimedPhase> timed_phases;
+static std::map<std::thread::id, size_t> thread_indices;
+
+static void append_json_character(std::string& escaped, char character) {
+    unsigned char code = static_cast<unsigned char>(character);
+    if (code >= 0x20) {
+        escaped += character;
+        return;
+    }
+    static const char hexadecimal_digits[] = "0123456789abcdef";
+    escaped += "\\u00";
+    escaped += hexadecimal_digits[code >> 4];
+    escaped += hexadecimal_digits[code & 0xF];
+}
+
+static std::string escape_json_string(const std::string& text) {
+    std::string escaped;
+    for (char character : text) {
+        switch (character) {
+            break; case '"':  escaped += "\\\"";
+            break; case '\\': escaped += "\\\\";
+            break; case '\n': escaped += "\\n";
+            break; case '\t': escaped += "\\t";
+            break; case '\r': escaped += "\\r";
+            break; case '\b': escaped += "\\b";
+            break; case '\f': escaped += "\\f";
+            break; default:   append_json_character(escaped, character);
+        }
+    }
+    return escaped;
+}
+
+static double to_microseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+size_t CompilationStatistics::get_counter(Counter counter) {
+    return counters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+std::string CompilationStatistics::get_counter_name(Counter counter) {
+    switch (counter) {
+        case Counter::tokens:                   return "tokens";
+        case Counter::ast_nodes:                return "ast nodes";
+        case Counter::ast_arena_bytes:          return "ast arena bytes";
+        case Counter::overload_resolutions:     return "overload resolutions";
+        case Counter::fast_retrieve_cache_hits: return "fast retrieve cache hits";
+        case Counter::generic_instantiations:   return "generic instantiations";
+        case Counter::instantiation_table_hits: return "instantiation table hits";
+        case Counter::llvm_functions_emitted:   return "llvm functions emitted";
+        case Counter::counters_count:           break;
+    }
+    assert_unreachable();
+}
+
+void CompilationStatistics::record_timed_phase(
+    const std::string& phase_name,
+    const std::string& detail,
+    std::chrono::steady_clock::time_point start_instant,
+    std::chrono::steady_clock::time_point end_instant
+) {
+    std::lock_guard<std::mutex> lock(timed_phases_mutex);
+    auto thread_index_insertion = thread_indices.insert({std::this_thread::get_id(), thread_indices.size()});
+    size_t thread_index = thread_index_insertion.first->second;
+    timed_phases.push_back(TimedPhase { phase_name, detail, start_instant, end_instant, thread_index });
+}
+
+void CompilationStatistics::reset() {
+    std::lock_guard<std::mutex> lock(timed_phases_mutex);
+    for (std::atomic<size_t>& counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    timed_phases.clear();
+    thread_indices.clear();
+}
+
+void CompilationStatistics::print_summary(std::ostream& output_stream) {
+    std::lock_guard<std::mutex> lock(timed_phases_mutex);
+    std::vector<std::string> phase_names;
+    std::map<std::string, std::chrono::steady_clock::duration> phase_durations;
+    std::map<std::string, size_t> phase_runs;
+    for (const TimedPhase& timed_phase : timed_phases) {
+        if (phase_runs.find(timed_phase.phase_name) == phase_runs.end()) {
+            phase_names.push_back(timed_phase.phase_name);
+            phase_durations[timed_phase.phase_name] = std::chrono::steady_clock::duration::zero();
+        }
+        phase_durations[timed_phase.phase_name] += timed_phase.end_instant - timed_phase.start_instant;
+        phase_runs[timed_phase.phase_name]++;
+    }
+    output_stream << "Compilation statistics:" << std::endl;
+    output_stream << std::fixed << std::setprecision(3);
+    for (const std::string& phase_name : phase_names) {
+        output_stream << "  " << std::left << std::setw(48) << phase_name 
+            << std::right << std::setw(12) << to_microseconds(phase_durations[phase_name]) / 1000.0 << " ms"
+            << "  (" << phase_runs[phase_name] << " runs)" << std::endl;
+    }
+    for (size_t counter_index = 0; counter_index < counters.size(); counter_index++) {
+        Counter counter = static_cast<Counter>(counter_index);
+        output_stream << "  " << std::left << std::setw(48) << get_counter_name(counter) 
+            << std::right << std::setw(12) << get_counter(counter) << std::endl;
+    }
+}
+
+void CompilationStatistics::write_chrome_trace(std::ostream& output_stream) {
+    std::lock_guard<std::mutex> lock(timed_phases_mutex);
+    output_stream << std::fixed << std::setprecision(3);
+    output_stream << "{\"traceEvents\":[";
+    for (size_t phase_index = 0; phase_index < timed_phases.size(); phase_index++) {
+        const TimedPhase& timed_phase = timed_phases[phase_index];
+        output_stream << ((phase_index == 0) ? "\n" : ",\n");
+        output_stream << "{\"name\":\"" << escape_json_string(timed_phase.phase_name) << "\"";
+        output_stream << ",\"cat\":\"basalt\",\"ph\":\"X\",\"pid\":1";
+        output_stream << ",\"tid\":" << timed_phase.thread_index;
+        output_stream << ",\"ts\":" << to_microseconds(timed_phase.start_instant - process_startup_instant);
+        output_stream << ",\"dur\":" << to_microseconds(timed_phase.end_instant - timed_phase.start_instant);
+        output_stream << ",\"args\":{\"detail\":\"" << escape_json_string(timed_phase.detail) << "\"}}";
+    }
+    output_stream << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{";
+    for (size_t counter_index = 0; counter_index < counters.size(); counter_index++) {
+        Counter counter = static_cast<Counter>(counter_index);
+        output_stream << ((counter_index == 0) ? "" : ",");
+        output_stream << "\"" << get_counter_name(counter) << "\":" << get_counter(counter);
+    }
+    output_stream << "}}" << std::endl;
+}
+
+ScopedPhaseTimer::ScopedPhaseTimer(const std::string& phase_name, const std::string& detail)
+    : phase_name(phase_name)
+    , detail(detail)
+    , start_instant(std::chrono::steady_clock::now())
+{ }
+
+ScopedPhaseTimer::~ScopedPhaseTimer() {
+    CompilationStatistics::record_timed_phase(phase_name, detail, start_instant, std::chrono::steady_clock::now());
+}
\ No newline at end of file
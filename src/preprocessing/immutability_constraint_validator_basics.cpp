@@ -16,7 +16,7 @@ void ImmutabilityConstraintValidator::visit_all_function_definitions() {
 }
 
 void ImmutabilityConstraintValidator::visit_function_definition(const FunctionDefinition& function_definition) {
-    ScopeContext scope_context(function_definition);
+    ScopeContext scope_context = program_representation.create_function_scope_context(function_definition);
     SingleFunctionImmutabilityConstraintValidator single_function_immutability_constraint_validator(
         scope_context,
         program_representation
@@ -12,6 +12,7 @@
 #include "preprocessing/address_sanitizer.hpp"
 #include "preprocessing/main_functions_preprocessor.hpp"
 #include "errors/internal_errors.hpp"
+#include "misc/compilation_statistics.hpp"
 #include "errors/parsing_errors.hpp"
 
 PreProcessor::PreProcessor(
@@ -21,11 +22,13 @@ PreProcessor::PreProcessor(
 {}
 
 void PreProcessor::preprocess_packages_typename_conflicts() {
+    ScopedPhaseTimer phase_timer("PackageTypeConflictNavigator");
     PackageTypeConflictNavigator package_type_conflict_navigator(program_representation);
     package_type_conflict_navigator.visit_all_packages();
 }
 
 void PreProcessor::preprocess_type_definitions() {
+    ScopedPhaseTimer phase_timer("TypeDependencyNavigator");
     TypeDependencyNavigator type_dependency_navigator(program_representation);
     type_dependency_navigator.visit_all_type_definitions();
 }
@@ -36,9 +39,24 @@ void PreProcessor::preprocess_function_definitions() {
     ImmutabilityConstraintValidator immutability_constraint_validator(program_representation);
     FunctionExitPathNavigator function_exit_path_navigator(program_representation);
     MainFunctionsPreprocessor main_functions_preprocessor(program_representation);
-    address_sanitizer.visit_all_function_definitions();
-    function_definitions_type_checker.visit_all_function_definitions();
-    immutability_constraint_validator.visit_all_function_definitions();
-    function_exit_path_navigator.visit_all_function_definitions();
-    main_functions_preprocessor.preprocess_all_main_functions();
+    {
+        ScopedPhaseTimer phase_timer("AddressSanitizer");
+        address_sanitizer.visit_all_function_definitions();
+    }
+    {
+        ScopedPhaseTimer phase_timer("FunctionDefinitionsTypeChecker");
+        function_definitions_type_checker.visit_all_function_definitions();
+    }
+    {
+        ScopedPhaseTimer phase_timer("ImmutabilityConstraintValidator");
+        immutability_constraint_validator.visit_all_function_definitions();
+    }
+    {
+        ScopedPhaseTimer phase_timer("FunctionExitPathNavigator");
+        function_exit_path_navigator.visit_all_function_definitions();
+    }
+    {
+        ScopedPhaseTimer phase_timer("MainFunctionsPreprocessor");
+        main_functions_preprocessor.preprocess_all_main_functions();
+    }
 }
\ No newline at end of file
@@ -18,6 +18,10 @@ Expression::as_debug_informations_aware_entity() const {
     return ptr->as_debug_informations_aware_entity();
 }
 
+const ExpressionBody& Expression::as_expression_body() const {
+    return *ptr;
+}
+
 bool Expression::is_literal() const {
     switch (expression_kind()) {
         case ExpressionBody::Kind::int_literal: 
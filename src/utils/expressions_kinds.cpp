@@ -6,53 +6,53 @@
 #include "language/expressions.hpp"
 
 ExpressionBody::Kind Expression::expression_kind() const {
-    return ptr->expression_kind();
+    return kind_tag;
 }
 
 ExpressionBody::Kind SquareBracketsAccess::expression_kind() const {
-    return ExpressionBody::Kind::square_bracket_access;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind DotMemberAccess::expression_kind() const {
-    return ExpressionBody::Kind::dot_member_access;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind ArrayLiteral::expression_kind() const {
-    return ExpressionBody::Kind::array_literal;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind TypeOperator::expression_kind() const {
-    return ExpressionBody::Kind::type_operator;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind BinaryOperator::expression_kind() const {
-    return ExpressionBody::Kind::binary_operator;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind UnaryOperator::expression_kind() const {
-    return ExpressionBody::Kind::unary_operator;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind Identifier::expression_kind() const {
-    return ExpressionBody::Kind::identifier;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind StringLiteral::expression_kind() const {
-    return ExpressionBody::Kind::string_literal;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind IntLiteral::expression_kind() const {
-    return ExpressionBody::Kind::int_literal;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind FloatLiteral::expression_kind() const {
-    return ExpressionBody::Kind::float_literal;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind BoolLiteral::expression_kind() const {
-    return ExpressionBody::Kind::bool_literal;
+    return expression_kind_tag;
 }
 
 ExpressionBody::Kind CharLiteral::expression_kind() const {
-    return ExpressionBody::Kind::char_literal;
+    return expression_kind_tag;
 }
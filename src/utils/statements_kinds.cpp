@@ -6,41 +6,41 @@
 #include "language/statements.hpp"
 
 StatementBody::Kind Statement::statement_kind() const {
-    return ptr->statement_kind();
+    return kind_tag;
 }
 
 StatementBody::Kind VariableDeclaration::statement_kind() const {
-    return StatementBody::Kind::variable_declaration;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind ConstDeclaration::statement_kind() const {
-    return StatementBody::Kind::const_declaration;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind Assignment::statement_kind() const {
-    return StatementBody::Kind::assignment;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind Conditional::statement_kind() const {
-    return StatementBody::Kind::conditional;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind WhileLoop::statement_kind() const {
-    return StatementBody::Kind::while_loop;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind UntilLoop::statement_kind() const {
-    return StatementBody::Kind::until_loop;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind Return::statement_kind() const {
-    return StatementBody::Kind::return_statement;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind Continue::statement_kind() const {
-    return StatementBody::Kind::continue_statement;
+    return statement_kind_tag;
 }
 
 StatementBody::Kind Break::statement_kind() const {
-    return StatementBody::Kind::break_statement;
+    return statement_kind_tag;
 }
@@ -6,33 +6,33 @@
 #include "language/typesignatures.hpp"
 
 TypeSignatureBody::Kind TypeSignature::typesiganture_kind() const {
-    return ptr->typesiganture_kind();
+    return kind_tag;
 };
 
 TypeSignatureBody::Kind CustomType::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::custom_type;
+    return typesignature_kind_tag;
 };
 
 TypeSignatureBody::Kind InlineUnion::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::inline_union;
+    return typesignature_kind_tag;
 };
 
 TypeSignatureBody::Kind TemplateType::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::template_type;
+    return typesignature_kind_tag;
 };
 
 TypeSignatureBody::Kind PrimitiveType::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::primitive_type;
+    return typesignature_kind_tag;
 };
 
 TypeSignatureBody::Kind PointerType::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::pointer_type;
+    return typesignature_kind_tag;
 };
 
 TypeSignatureBody::Kind ArrayType::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::array_type;
+    return typesignature_kind_tag;
 };
 
 TypeSignatureBody::Kind SliceType::typesiganture_kind() const {
-    return TypeSignatureBody::Kind::slice_type;
+    return typesignature_kind_tag;
 };
\ No newline at end of file
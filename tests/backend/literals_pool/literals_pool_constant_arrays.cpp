@@ -0,0 +1,37 @@
+
+#include <gtest/gtest.h>
+#include "backend/literals_pool.hpp"
+
+static llvm::Constant* make_constant_int_array(llvm::LLVMContext& context, const std::vector<int>& values) {
+    std::vector<llvm::Constant*> elements;
+    for (int value : values) {
+        elements.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), value));
+    }
+    llvm::ArrayType* array_type = llvm::ArrayType::get(llvm::Type::getInt64Ty(context), values.size());
+    return llvm::ConstantArray::get(array_type, elements);
+}
+
+TEST(Backend, Constant_Array_Interned_As_Private_Unnamed_Addr_Constant) {
+    llvm::LLVMContext context;
+    llvm::Module llvm_module("ConstantArrayInterned", context);
+    LiteralsPool literals_pool(context, llvm_module);
+    llvm::GlobalVariable* global_array = literals_pool.intern_constant_array(
+        make_constant_int_array(context, { 3, -1, 4, 1, -5 })
+    );
+    EXPECT_TRUE(global_array->isConstant());
+    EXPECT_TRUE(global_array->hasPrivateLinkage());
+    EXPECT_TRUE(global_array->hasGlobalUnnamedAddr());
+    EXPECT_EQ(llvm_module.global_size(), 1);
+}
+
+TEST(Backend, Identical_Constant_Arrays_Share_The_Same_Global) {
+    llvm::LLVMContext context;
+    llvm::Module llvm_module("IdenticalConstantArrays", context);
+    LiteralsPool literals_pool(context, llvm_module);
+    llvm::GlobalVariable* first = literals_pool.intern_constant_array(make_constant_int_array(context, { 1, 2, 3 }));
+    llvm::GlobalVariable* second = literals_pool.intern_constant_array(make_constant_int_array(context, { 1, 2, 3 }));
+    llvm::GlobalVariable* third = literals_pool.intern_constant_array(make_constant_int_array(context, { 1, 2, 4 }));
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, third);
+    EXPECT_EQ(llvm_module.global_size(), 2);
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+
+#include <gtest/gtest.h>
+#include "backend/literals_pool.hpp"
+
+static llvm::StructType* make_string_struct_type(llvm::LLVMContext& context) {
+    llvm::Type* length_type = llvm::Type::getInt64Ty(context);
+    llvm::Type* char_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
+    return llvm::StructType::create(context, { length_type, char_ptr_type }, "String");
+}
+
+TEST(Backend, String_Literal_Interned_As_Constant_Descriptor) {
+    llvm::LLVMContext context;
+    llvm::Module llvm_module("StringLiteralInterned", context);
+    LiteralsPool literals_pool(context, llvm_module);
+    llvm::GlobalVariable* string_descriptor = literals_pool.intern_string_literal("hello", make_string_struct_type(context));
+    EXPECT_TRUE(string_descriptor->isConstant());
+    EXPECT_TRUE(string_descriptor->hasPrivateLinkage());
+    EXPECT_TRUE(string_descriptor->hasGlobalUnnamedAddr());
+    auto descriptor_value = llvm::cast<llvm::ConstantStruct>(string_descriptor->getInitializer());
+    auto string_length = llvm::cast<llvm::ConstantInt>(descriptor_value->getOperand(0));
+    EXPECT_EQ(string_length->getZExtValue(), 5);
+}
+
+TEST(Backend, Identical_String_Literals_Share_The_Same_Globals) {
+    llvm::LLVMContext context;
+    llvm::Module llvm_module("IdenticalStringLiterals", context);
+    LiteralsPool literals_pool(context, llvm_module);
+    llvm::StructType* string_type = make_string_struct_type(context);
+    llvm::GlobalVariable* first = literals_pool.intern_string_literal("hello", string_type);
+    llvm::GlobalVariable* second = literals_pool.intern_string_literal("hello", string_type);
+    llvm::GlobalVariable* third = literals_pool.intern_string_literal("world", string_type);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, third);
+    EXPECT_EQ(llvm_module.global_size(), 4);
+}
\ No newline at end of file
@@ -78,7 +78,7 @@ TEST(Backend, Number_Union_Translated_Correctly_From_Definition) {
     std::string llvm_number_union_translation_str;
     llvm::raw_string_ostream llvm_ostream(llvm_number_union_translation_str);
     llvm_number_union_translation->print(llvm_ostream);
-    EXPECT_EQ(llvm_number_union_translation_str, R"(%"testpackage::Number" = type { i8*, [8 x i8] })");
+    EXPECT_EQ(llvm_number_union_translation_str, R"(%"testpackage::Number" = type { i64, [8 x i8] })");
 }
 
 TEST(Backend, IntOrFloat_Translated_Twice_Correctly) {
@@ -101,8 +101,8 @@ TEST(Backend, IntOrFloat_Translated_Twice_Correctly) {
     llvm_number_union_translation1->print(llvm_ostream1);
     llvm_number_union_translation2->print(llvm_ostream2);
     EXPECT_EQ(llvm_number_union_translation1_str, llvm_number_union_translation2_str);
-    EXPECT_EQ(llvm_number_union_translation1_str, R"(%"Int | Float" = type { i8*, [8 x i8] })");
-    EXPECT_EQ(llvm_number_union_translation2_str, R"(%"Int | Float" = type { i8*, [8 x i8] })");
+    EXPECT_EQ(llvm_number_union_translation1_str, R"(%"Int | Float" = type { i64, [8 x i8] })");
+    EXPECT_EQ(llvm_number_union_translation2_str, R"(%"Int | Float" = type { i64, [8 x i8] })");
 }
 
 TEST(Backend, IntOrFloat_Translated_Correctly_From_TypeSignature) {
@@ -119,5 +119,5 @@ TEST(Backend, IntOrFloat_Translated_Correctly_From_TypeSignature) {
     std::string llvm_int_or_float_union_translation_str;
     llvm::raw_string_ostream llvm_ostream(llvm_int_or_float_union_translation_str);
     llvm_int_or_float_union_translation->print(llvm_ostream);
-    EXPECT_EQ(llvm_int_or_float_union_translation_str, R"(%"Int | Float" = type { i8*, [8 x i8] })");
+    EXPECT_EQ(llvm_int_or_float_union_translation_str, R"(%"Int | Float" = type { i64, [8 x i8] })");
 }
\ No newline at end of file
@@ -24,6 +24,39 @@ TEST(Core, Assignment_Type_Checking_For_Float_Assigned_To_Int) {
     EXPECT_FALSE(float_is_compatible_with_int);
 }
 
+TEST(Core, Assignment_Type_Checking_For_Int_Assigned_To_Int32) {
+    ProjectFileStructure empty_project;
+    TypeDefinitionsRegister type_register(empty_project); 
+    AssignmentTypeChecker type_checker(type_register, empty_project);
+    bool int_is_compatible_with_int32 = type_checker.validate_assignment(TypeSignatureFactory::Int, TypeSignatureFactory::Int32);
+    EXPECT_TRUE(int_is_compatible_with_int32);
+}
+
+TEST(Core, Assignment_Type_Checking_For_Int32_Assigned_To_Int) {
+    ProjectFileStructure empty_project;
+    TypeDefinitionsRegister type_register(empty_project); 
+    AssignmentTypeChecker type_checker(type_register, empty_project);
+    bool int32_is_compatible_with_int = type_checker.validate_assignment(TypeSignatureFactory::Int32, TypeSignatureFactory::Int);
+    EXPECT_TRUE(int32_is_compatible_with_int);
+}
+
+TEST(Core, Assignment_Type_Checking_For_Pointer_To_Int32_Assigned_To_Pointer_To_Int) {
+    ProjectFileStructure empty_project;
+    TypeDefinitionsRegister type_register(empty_project); 
+    AssignmentTypeChecker type_checker(type_register, empty_project);
+    TypeSignature pointer_to_int32 = PointerType{ Token { "#", "test.basalt", 1, 1, 1, Token::Type::symbol }, TypeSignatureFactory::Int32 };
+    bool pointer_to_int32_is_compatible_with_pointer_to_int = type_checker.validate_assignment(pointer_to_int32, TypeSignatureFactory::PointerToInt);
+    EXPECT_FALSE(pointer_to_int32_is_compatible_with_pointer_to_int);
+}
+
+TEST(Core, Assignment_Type_Checking_For_Float_Assigned_To_Int32) {
+    ProjectFileStructure empty_project;
+    TypeDefinitionsRegister type_register(empty_project); 
+    AssignmentTypeChecker type_checker(type_register, empty_project);
+    bool float_is_compatible_with_int32 = type_checker.validate_assignment(TypeSignatureFactory::Float, TypeSignatureFactory::Int32);
+    EXPECT_FALSE(float_is_compatible_with_int32);
+}
+
 TEST(Core, Assignment_Type_Checking_For_Bool_Assigned_To_Float) {
     ProjectFileStructure empty_project;
     TypeDefinitionsRegister type_register(empty_project); 
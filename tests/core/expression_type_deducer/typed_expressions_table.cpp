@@ -0,0 +1,55 @@
+
+#include <gtest/gtest.h>
+#include "errors/internal_errors.hpp"
+#include "core/expression_type_deducer.hpp"
+#include "core/typed_expressions_table.hpp"
+
+#include "../../tests_utilities/typesignature_factory.hpp"
+
+static ProjectFileStructure empty_project;
+static TypeDefinitionsRegister empty_type_register(empty_project);
+static FunctionDefinitionsRegister empty_function_definitions_register(empty_type_register, empty_project);
+static CommonFeatureAdoptionPlanGenerationEngine empty_common_feature_adoption_plan_generation_engine(empty_function_definitions_register, empty_type_register);
+
+TEST(Core, Type_Deduction_Records_Every_Subexpression_In_The_Typed_Expressions_Table) {
+    ScopeContext scope_context;
+    ExpressionTypeDeducer type_deducer(
+        empty_type_register,
+        empty_function_definitions_register,
+        empty_common_feature_adoption_plan_generation_engine,
+        empty_project,
+        scope_context
+    );
+    Expression left_operand = IntLiteral { Token { "1", "main.basalt", 1, 1, 1, Token::Type::integer_literal } };
+    Expression right_operand = IntLiteral { Token { "2", "main.basalt", 1, 1, 1, Token::Type::integer_literal } };
+    Expression sum = BinaryOperator { Token { "+", "main.basalt", 1, 1, 1, Token::Type::symbol }, left_operand, right_operand };
+    std::optional<TypeSignature> sum_type = type_deducer.deduce_expression_type(sum);
+    ASSERT_TRUE(sum_type.has_value());
+    TypedExpressionsTable& typed_expressions_table = scope_context.get_typed_expressions_table();
+    ASSERT_TRUE(typed_expressions_table.contains_expression_type(sum));
+    ASSERT_TRUE(typed_expressions_table.contains_expression_type(sum.get<BinaryOperator>().left_operand));
+    ASSERT_TRUE(typed_expressions_table.contains_expression_type(sum.get<BinaryOperator>().right_operand));
+    const std::optional<TypeSignature>& recorded_type = typed_expressions_table.get_expression_type(sum);
+    ASSERT_TRUE(recorded_type.has_value());
+    ASSERT_TRUE(recorded_type.value().is<PrimitiveType>());
+    EXPECT_EQ(recorded_type.value().get<PrimitiveType>().type_name, int_type);
+}
+
+TEST(Core, Type_Deduction_Consumes_Types_Already_Recorded_In_The_Typed_Expressions_Table) {
+    ScopeContext scope_context;
+    ExpressionTypeDeducer type_deducer(
+        empty_type_register,
+        empty_function_definitions_register,
+        empty_common_feature_adoption_plan_generation_engine,
+        empty_project,
+        scope_context
+    );
+    Expression undeclared_identifier = Identifier { Token { "x", "main.basalt", 1, 1, 1, Token::Type::text } };
+    EXPECT_ANY_THROW({ std::ignore = type_deducer.deduce_expression_type(undeclared_identifier); });
+    TypeSignature float_typesignature = PrimitiveType { Token { float_type, "main.basalt", 1, 1, 1, Token::Type::type } };
+    scope_context.get_typed_expressions_table().store_expression_type(undeclared_identifier, float_typesignature);
+    std::optional<TypeSignature> identifier_type = type_deducer.deduce_expression_type(undeclared_identifier);
+    ASSERT_TRUE(identifier_type.has_value());
+    ASSERT_TRUE(identifier_type.value().is<PrimitiveType>());
+    EXPECT_EQ(identifier_type.value().get<PrimitiveType>().type_name, float_type);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+
+#include <gtest/gtest.h>
+#include "core/function_definitions_register.hpp"
+#include "core/type_definitions_register.hpp"
+#include "errors/internal_errors.hpp"
+#include "../../tests_utilities/typesignature_factory.hpp"
+#include "../../tests_utilities/function_definition_factory.hpp"
+
+ProjectFileStructure project_with_a_generic_function_called_from_multiple_files({
+    FileRepresentation {
+        .file_metadata = {
+            .filename = "main.basalt",
+            .packagename = "mainpackage",
+            .imports = {"genericimpl"}
+        },
+        .type_defs = {},
+        .func_defs = {}
+    },
+    FileRepresentation {
+        .file_metadata = {
+            .filename = "other.basalt",
+            .packagename = "mainpackage",
+            .imports = {"genericimpl"}
+        },
+        .type_defs = {},
+        .func_defs = {}
+    },
+    FileRepresentation {
+        .file_metadata = {
+            .filename = "genericimpl.basalt",
+            .packagename = "genericimpl",
+            .imports = {}
+        },
+        .type_defs = {},
+        .func_defs = {
+            FunctionDefinitionFactory::make_function_definition(
+                "add",
+                "genericimpl.basalt",
+                { "T" },
+                {
+                    FunctionDefinition::Argument { "a", TypeSignatureFactory::T },
+                    FunctionDefinition::Argument { "b", TypeSignatureFactory::T }
+                },
+                TypeSignatureFactory::T
+            )
+        }
+    }
+});
+
+FunctionCall make_add_function_call_from_file(
+    const std::string& filename, 
+    const std::vector<TypeSignature>& instantiated_generics
+) {
+    return FunctionCall {
+        Token { "add", filename, 1, 2, 5, Token::Type::text },
+        {
+            IntLiteral { Token { "1", filename, 1, 2, 5, Token::Type::integer_literal } },
+            IntLiteral { Token { "1", filename, 1, 2, 5, Token::Type::integer_literal } }
+        },
+        instantiated_generics
+    };
+}
+
+size_t count_function_definitions(FunctionDefinitionsRegister& function_definitions_register) {
+    size_t number_of_function_definitions = 0;
+    function_definitions_register.foreach_function_definition([&](FunctionDefinition::Ref) {
+        number_of_function_definitions++;
+    });
+    return number_of_function_definitions;
+}
+
+TEST(Core, Generic_Function_Called_From_Different_Files_Is_Instantiated_Only_Once) {
+    ProjectFileStructure& proj = project_with_a_generic_function_called_from_multiple_files;
+    TypeDefinitionsRegister type_register(proj);
+    FunctionDefinitionsRegister overoad_resolver(type_register, proj);
+    std::vector<TypeSignature> arg_types = { TypeSignatureFactory::Int, TypeSignatureFactory::Int };
+    FunctionCall call_from_main = make_add_function_call_from_file("main.basalt", {});
+    FunctionCall call_from_other = make_add_function_call_from_file("other.basalt", {});
+    FunctionDefinition::Ref first_func_def_ref = overoad_resolver.retrieve_function_definition(call_from_main, arg_types);
+    FunctionDefinition::Ref second_func_def_ref = overoad_resolver.retrieve_function_definition(call_from_other, arg_types);
+    ASSERT_NE(first_func_def_ref, nullptr);
+    EXPECT_EQ(first_func_def_ref, second_func_def_ref);
+    EXPECT_EQ(first_func_def_ref->function_name, "add<Int>");
+    EXPECT_TRUE(first_func_def_ref->is_generic_instantiation);
+    EXPECT_EQ(count_function_definitions(overoad_resolver), 2);
+}
+
+TEST(Core, Generic_Function_Called_With_Explicit_And_Inferred_Generics_Is_Instantiated_Only_Once) {
+    ProjectFileStructure& proj = project_with_a_generic_function_called_from_multiple_files;
+    TypeDefinitionsRegister type_register(proj);
+    FunctionDefinitionsRegister overoad_resolver(type_register, proj);
+    std::vector<TypeSignature> arg_types = { TypeSignatureFactory::Int, TypeSignatureFactory::Int };
+    FunctionCall inferred_call = make_add_function_call_from_file("main.basalt", {});
+    FunctionCall explicit_call = make_add_function_call_from_file("other.basalt", { TypeSignatureFactory::Int });
+    FunctionDefinition::Ref inferred_func_def_ref = overoad_resolver.retrieve_function_definition(inferred_call, arg_types);
+    FunctionDefinition::Ref explicit_func_def_ref = overoad_resolver.retrieve_function_definition(explicit_call, arg_types);
+    ASSERT_NE(inferred_func_def_ref, nullptr);
+    EXPECT_EQ(inferred_func_def_ref, explicit_func_def_ref);
+    EXPECT_EQ(count_function_definitions(overoad_resolver), 2);
+}
+
+TEST(Core, Generic_Function_Called_With_Different_Substitutions_Is_Instantiated_Once_Per_Substitution) {
+    ProjectFileStructure& proj = project_with_a_generic_function_called_from_multiple_files;
+    TypeDefinitionsRegister type_register(proj);
+    FunctionDefinitionsRegister overoad_resolver(type_register, proj);
+    std::vector<TypeSignature> int_arg_types = { TypeSignatureFactory::Int, TypeSignatureFactory::Int };
+    std::vector<TypeSignature> float_arg_types = { TypeSignatureFactory::Float, TypeSignatureFactory::Float };
+    FunctionCall call_from_main = make_add_function_call_from_file("main.basalt", {});
+    FunctionCall call_from_other = make_add_function_call_from_file("other.basalt", {});
+    FunctionDefinition::Ref int_func_def_ref = overoad_resolver.retrieve_function_definition(call_from_main, int_arg_types);
+    FunctionDefinition::Ref float_func_def_ref = overoad_resolver.retrieve_function_definition(call_from_other, float_arg_types);
+    FunctionDefinition::Ref float_func_def_ref_again = overoad_resolver.retrieve_function_definition(call_from_main, float_arg_types);
+    ASSERT_NE(int_func_def_ref, nullptr);
+    ASSERT_NE(float_func_def_ref, nullptr);
+    EXPECT_NE(int_func_def_ref, float_func_def_ref);
+    EXPECT_EQ(float_func_def_ref, float_func_def_ref_again);
+    EXPECT_EQ(float_func_def_ref->function_name, "add<Float>");
+    EXPECT_EQ(count_function_definitions(overoad_resolver), 3);
+}
\ No newline at end of file
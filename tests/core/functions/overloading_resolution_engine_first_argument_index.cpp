@@ -0,0 +1,88 @@
+
+#include <gtest/gtest.h>
+#include "core/function_definitions_register.hpp"
+#include "core/type_definitions_register.hpp"
+#include "errors/internal_errors.hpp"
+#include "errors/parsing_errors.hpp"
+#include "../../tests_utilities/struct_definition_factory.hpp"
+#include "../../tests_utilities/typesignature_factory.hpp"
+#include "../../tests_utilities/function_definition_factory.hpp"
+#include "../../tests_utilities/type_alias_factory.hpp"
+
+static FunctionDefinition make_print_overload(
+    const std::vector<std::string>& generics, 
+    const TypeSignature& arg_type
+) {
+    return FunctionDefinitionFactory::make_function_definition(
+        "print", 
+        "main.basalt",
+        generics, 
+        { FunctionDefinition::Argument { "x", arg_type } },
+        std::nullopt
+    );
+}
+
+ProjectFileStructure simple_project_with_print_overloads_of_every_category({
+    FileRepresentation {
+        .file_metadata = {
+            .filename = "main.basalt",
+            .packagename = "simple_project_with_print_overloads",
+            .imports = {}
+        },
+        .type_defs = {},
+        .func_defs = {
+            make_print_overload(FunctionDefinitionFactory::no_generics, TypeSignatureFactory::Int),
+            make_print_overload(FunctionDefinitionFactory::no_generics, TypeSignatureFactory::Float),
+            make_print_overload(FunctionDefinitionFactory::no_generics, TypeSignatureFactory::String),
+            make_print_overload(FunctionDefinitionFactory::no_generics, TypeSignatureFactory::IntOrFloat),
+            make_print_overload(FunctionDefinitionFactory::no_generics, TypeSignatureFactory::PointerToInt),
+            make_print_overload({ "T" }, TypeSignatureFactory::T)
+        }
+    }
+});
+
+static FunctionDefinition::Ref resolve_print_overload(const TypeSignature& provided_arg_type) {
+    ProjectFileStructure& proj = simple_project_with_print_overloads_of_every_category;
+    TypeDefinitionsRegister type_register(proj);
+    FunctionDefinitionsRegister overoad_resolver(type_register, proj);
+    FunctionCall func_call {
+        Token { "print", "main.basalt", 1, 2, 5, Token::Type::text },
+        { IntLiteral { Token { "1", "main.basalt", 1, 2, 5, Token::Type::integer_literal } } },
+        {  }
+    };
+    return overoad_resolver.retrieve_function_definition(func_call, { provided_arg_type });
+}
+
+TEST(Core, Overloading_Resolution_Picks_Exact_Primitive_Overload_Over_Union_And_Generic) {
+    FunctionDefinition::Ref func_def_ref = resolve_print_overload(TypeSignatureFactory::Float);
+    ASSERT_NE(func_def_ref, nullptr);
+    EXPECT_EQ(func_def_ref->function_name, "print");
+    EXPECT_EQ(func_def_ref->arguments[0].arg_type.get<PrimitiveType>().type_name, float_type);
+}
+
+TEST(Core, Overloading_Resolution_Finds_String_Overload_From_String_Argument) {
+    FunctionDefinition::Ref func_def_ref = resolve_print_overload(TypeSignatureFactory::String);
+    ASSERT_NE(func_def_ref, nullptr);
+    EXPECT_EQ(func_def_ref->function_name, "print");
+    EXPECT_EQ(func_def_ref->arguments[0].arg_type.get<PrimitiveType>().type_name, string_type);
+}
+
+TEST(Core, Overloading_Resolution_Finds_Pointer_Overload_From_Pointer_Argument) {
+    FunctionDefinition::Ref func_def_ref = resolve_print_overload(TypeSignatureFactory::PointerToInt);
+    ASSERT_NE(func_def_ref, nullptr);
+    EXPECT_EQ(func_def_ref->function_name, "print");
+    EXPECT_TRUE(func_def_ref->arguments[0].arg_type.is<PointerType>());
+}
+
+TEST(Core, Overloading_Resolution_Finds_Union_Overload_From_Union_Argument) {
+    FunctionDefinition::Ref func_def_ref = resolve_print_overload(TypeSignatureFactory::IntOrFloat);
+    ASSERT_NE(func_def_ref, nullptr);
+    EXPECT_EQ(func_def_ref->function_name, "print");
+    EXPECT_TRUE(func_def_ref->arguments[0].arg_type.is<InlineUnion>());
+}
+
+TEST(Core, Overloading_Resolution_Falls_Back_To_Generic_Overload_When_No_Category_Matches) {
+    FunctionDefinition::Ref func_def_ref = resolve_print_overload(TypeSignatureFactory::Bool);
+    ASSERT_NE(func_def_ref, nullptr);
+    EXPECT_EQ(func_def_ref->function_name, "print<Bool>");
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "frontend/tokenizer.hpp"
+#include "frontend/parser.hpp"
+#include "core/generics_substitution_rules.hpp"
+#include "core/generics_instantiation_engine.hpp"
+#include "../../tests_utilities/typesignature_factory.hpp"
+#include "../../tests_utilities/type_queries.hpp"
+
+static FunctionDefinition parse_single_function_definition(const std::string& source) {
+    Tokenizer tokenizer = Tokenizer(std::istringstream(source));
+    Parser parser = Parser(tokenizer.tokenize());
+    return parser.parse_everything().func_defs.front();
+}
+
+static const std::string generic_function_source = 
+    "package main;"
+    "func wrap<T>(value : T) -> T {"
+    "    var counter : Int = 1 + 2 * 3;"
+    "    while (counter > 1) { counter = counter / 2; }"
+    "    var copy : T = value;"
+    "    return copy as T;"
+    "}";
+
+TEST(Core, Generic_Function_Body_Genericity_Is_Known_For_Every_Statement) {
+    FunctionDefinition generic_function = parse_single_function_definition(generic_function_source);
+    ASSERT_EQ(generic_function.code.size(), 4);
+    EXPECT_FALSE(generic_function.code[0].is_generic());
+    EXPECT_FALSE(generic_function.code[1].is_generic());
+    EXPECT_TRUE(generic_function.code[2].is_generic());
+    EXPECT_TRUE(generic_function.code[3].is_generic());
+    EXPECT_FALSE(generic_function.code[0].get<VariableDeclaration>().initial_value->is_generic());
+    EXPECT_TRUE(generic_function.code[3].get<Return>().return_value->is_generic());
+}
+
+TEST(Core, Generic_Function_Instantiation_Shares_Non_Generic_Statements) {
+    FunctionDefinition generic_function = parse_single_function_definition(generic_function_source);
+    GenericsInstantiationEngine engine({ GenericSubstitutionRule { "T", TypeSignatureFactory::Int } });
+    FunctionDefinition::Ref instantiated_function = engine.instantiate_generic_function(generic_function, "wrap_int");
+    ASSERT_EQ(instantiated_function->code.size(), 4);
+    EXPECT_EQ(&instantiated_function->code[0].get<VariableDeclaration>(), &generic_function.code[0].get<VariableDeclaration>());
+    EXPECT_EQ(&instantiated_function->code[1].get<WhileLoop>(), &generic_function.code[1].get<WhileLoop>());
+    EXPECT_NE(&instantiated_function->code[2].get<VariableDeclaration>(), &generic_function.code[2].get<VariableDeclaration>());
+    EXPECT_TRUE(is_int(instantiated_function->code[2].get<VariableDeclaration>().typesignature));
+    EXPECT_FALSE(instantiated_function->code[2].is_generic());
+}
+
+TEST(Core, Generic_Function_Instantiation_Substitutes_Template_Types_In_Returned_Values) {
+    FunctionDefinition generic_function = parse_single_function_definition(generic_function_source);
+    GenericsInstantiationEngine engine({ GenericSubstitutionRule { "T", TypeSignatureFactory::Int } });
+    FunctionDefinition::Ref instantiated_function = engine.instantiate_generic_function(generic_function, "wrap_int");
+    const Return& return_statement = instantiated_function->code[3].get<Return>();
+    ASSERT_TRUE(return_statement.return_value.has_value());
+    ASSERT_TRUE(return_statement.return_value->is<TypeOperator>());
+    EXPECT_TRUE(is_int(return_statement.return_value->get<TypeOperator>().typesignature));
+}
\ No newline at end of file
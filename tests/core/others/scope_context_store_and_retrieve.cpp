@@ -66,4 +66,35 @@ TEST(Core, Scope_Context_Say_Constant_Is_Non_Mutable) {
     scope_context.store_local_constant(a_const_of_type_int);
     EXPECT_TRUE(is_int(scope_context.get_local_object_type("a")));
     EXPECT_TRUE(scope_context.is_identifier_immutable("a"));
+}
+
+TEST(Core, Scope_Context_Nested_Scope_Sees_Parent_Objects_But_Not_Viceversa) {
+    ScopeContext scope_context;
+    scope_context.store_local_variable(x_variable_of_type_int);
+    ScopeContext nested_scope_context = scope_context.create_nested_scope();
+    nested_scope_context.store_local_constant(a_const_of_type_int);
+    EXPECT_TRUE(nested_scope_context.contains("x"));
+    EXPECT_TRUE(nested_scope_context.contains("a"));
+    EXPECT_FALSE(scope_context.contains("a"));
+    EXPECT_TRUE(nested_scope_context.contains("a"));
+    EXPECT_EQ(nested_scope_context.resolve_object_slot_id("x"), scope_context.resolve_object_slot_id("x"));
+}
+
+TEST(Core, Scope_Context_Sibling_Scopes_Do_Not_See_Each_Other_Objects) {
+    ScopeContext scope_context;
+    ScopeContext then_scope_context = scope_context.create_nested_scope();
+    ScopeContext else_scope_context = scope_context.create_nested_scope();
+    then_scope_context.store_local_variable(y_variable_of_type_int);
+    EXPECT_FALSE(else_scope_context.contains("y"));
+    else_scope_context.store_local_variable(y_variable_of_type_int);
+    EXPECT_TRUE(then_scope_context.contains("y"));
+    EXPECT_NE(then_scope_context.resolve_object_slot_id("y"), else_scope_context.resolve_object_slot_id("y"));
+    EXPECT_FALSE(scope_context.contains("y"));
+}
+
+TEST(Core, Scope_Context_Rejects_Shadowing_Of_Parent_Objects) {
+    ScopeContext scope_context;
+    scope_context.store_local_variable(z_variable_of_type_int);
+    ScopeContext nested_scope_context = scope_context.create_nested_scope();
+    EXPECT_ANY_THROW(nested_scope_context.store_local_variable(z_variable_of_type_int));
 }
\ No newline at end of file
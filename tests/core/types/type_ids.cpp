@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "core/type_definitions_register.hpp"
+#include "frontend/file_representation.hpp"
+#include "core/project_file_structure.hpp"
+#include "errors/internal_errors.hpp"
+#include "../../tests_utilities/struct_definition_factory.hpp"
+#include "../../tests_utilities/typesignature_factory.hpp"
+
+static FileRepresentation file_with_mystruct_def {
+    .file_metadata = { 
+        .filename = "test.basalt",
+        .packagename = "testpackage",
+        .imports = {},
+    },
+    .type_defs = {
+        StructDefinitionFactory::make_struct_definition(
+            "MyStruct", 
+            "test.basalt",
+            StructDefinitionFactory::no_generics, 
+            StructDefinitionFactory::no_fields
+        )
+    },
+    .func_defs = {}
+};
+
+TEST(Core, Structurally_Equal_TypeSignatures_Share_The_Same_TypeId) {
+    ProjectFileStructure project;
+    project.store_file_representation(file_with_mystruct_def);
+    TypeDefinitionsRegister type_register(project);
+    TypeSignature mystruct_1 = CustomType { Token { "MyStruct", "test.basalt", 1, 1, 1, Token::Type::type }, {} };
+    TypeSignature mystruct_2 = CustomType { Token { "MyStruct", "test.basalt", 7, 3, 9, Token::Type::type }, {} };
+    TypeSignature pointer_to_mystruct = PointerType { Token { "#", "test.basalt", 1, 1, 1, Token::Type::symbol }, mystruct_1 };
+    TypeSignature another_pointer_to_mystruct = PointerType { Token { "#", "test.basalt", 2, 1, 1, Token::Type::symbol }, mystruct_2 };
+    EXPECT_EQ(type_register.get_typesignature_id(mystruct_1), type_register.get_typesignature_id(mystruct_2));
+    EXPECT_EQ(type_register.get_typesignature_id(pointer_to_mystruct), type_register.get_typesignature_id(another_pointer_to_mystruct));
+    EXPECT_EQ(type_register.get_typesignature_id(TypeSignatureFactory::PointerToInt), type_register.get_typesignature_id(TypeSignatureFactory::PointerToInt));
+    EXPECT_NE(type_register.get_typesignature_id(mystruct_1), type_register.get_typesignature_id(pointer_to_mystruct));
+    EXPECT_NE(type_register.get_typesignature_id(TypeSignatureFactory::PointerToInt), type_register.get_typesignature_id(TypeSignatureFactory::PointerToFloat));
+    EXPECT_NE(type_register.get_typesignature_id(TypeSignatureFactory::ArrayOfInts), type_register.get_typesignature_id(TypeSignatureFactory::PointerToInt));
+}
+
+TEST(Core, TypeIds_Map_Back_To_Fully_Qualified_Names) {
+    ProjectFileStructure project;
+    project.store_file_representation(file_with_mystruct_def);
+    TypeDefinitionsRegister type_register(project);
+    TypeSignature mystruct = CustomType { Token { "MyStruct", "test.basalt", 1, 1, 1, Token::Type::type }, {} };
+    TypeSignature array_of_mystruct = ArrayType { Token { "[", "test.basalt", 1, 1, 1, Token::Type::symbol }, 4, mystruct };
+    TypeSignature mystruct_or_int = InlineUnion { Token { "MyStruct", "test.basalt", 1, 1, 1, Token::Type::type }, { mystruct, TypeSignatureFactory::Int } };
+    EXPECT_EQ(type_register.get_fully_qualified_name(type_register.get_typesignature_id(mystruct)), "testpackage::MyStruct");
+    EXPECT_EQ(type_register.get_fully_qualified_name(type_register.get_typesignature_id(array_of_mystruct)), "[4]testpackage::MyStruct");
+    EXPECT_EQ(type_register.get_fully_qualified_name(type_register.get_typesignature_id(mystruct_or_int)), "testpackage::MyStruct | Int");
+    EXPECT_EQ(type_register.get_fully_qualified_typesignature_name(TypeSignatureFactory::PointerToString), "#String");
+    EXPECT_EQ(type_register.get_typesignature_id(mystruct), type_register.get_fully_qualified_name_id("testpackage::MyStruct"));
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+
+#include <gtest/gtest.h>
+#include "core/type_definitions_register.hpp"
+#include "core/project_file_structure.hpp"
+#include "errors/internal_errors.hpp"
+#include "../../tests_utilities/union_definition_factory.hpp"
+#include "../../tests_utilities/type_alias_factory.hpp"
+#include "../../tests_utilities/typesignature_factory.hpp"
+
+static ProjectFileStructure project_with_nested_union_defs({
+    FileRepresentation {
+        .file_metadata = {
+            .filename = "test.basalt",
+            .packagename = "testpackage",
+            .imports = { }
+        },
+        .type_defs = { 
+            UnionDefinitionFactory::make_union_definition(
+                "Number", "test.basalt", { }, {
+                    TypeSignatureFactory::Int,
+                    TypeSignatureFactory::Float
+                }
+            ),
+            UnionDefinitionFactory::make_union_definition(
+                "NumberOrBool", "test.basalt", { }, {
+                    CustomType { Token { "Number", "test.basalt", 1, 1, 1, Token::Type::type }, {} },
+                    TypeSignatureFactory::Bool
+                }
+            ),
+            UnionDefinitionFactory::make_union_definition(
+                "Either", "test.basalt", { "T", "U" }, {
+                    TypeSignatureFactory::T,
+                    TypeSignatureFactory::U
+                }
+            ),
+            TypeAliasFactory::make_type_alias(
+                "Flag", "test.basalt", TypeAliasFactory::no_generics, TypeSignatureFactory::Bool
+            )
+        },
+        .func_defs = { }
+    }
+});
+
+static const TypeSignature number_type = CustomType { Token { "Number", "test.basalt", 1, 1, 1, Token::Type::type }, {} };
+static const TypeSignature number_or_bool_type = CustomType { Token { "NumberOrBool", "test.basalt", 1, 1, 1, Token::Type::type }, {} };
+static const TypeSignature flag_type = CustomType { Token { "Flag", "test.basalt", 1, 1, 1, Token::Type::type }, {} };
+
+TEST(Core, Union_Closure_Flattens_Nested_Unions) {
+    TypeDefinitionsRegister type_register(project_with_nested_union_defs);
+    const std::vector<TypeSignature>& flattened = 
+        type_register.fetch_non_union_compatible_types_for_union_assignment(number_or_bool_type);
+    ASSERT_EQ(flattened.size(), 3);
+    EXPECT_EQ(type_register.fetch_union_alternatives(number_or_bool_type).size(), 2);
+    EXPECT_TRUE(type_register.is_union(number_or_bool_type));
+    EXPECT_TRUE(type_register.is_union(TypeSignatureFactory::IntOrFloat));
+    EXPECT_FALSE(type_register.is_union(TypeSignatureFactory::Int));
+    EXPECT_FALSE(type_register.is_union(flag_type));
+}
+
+TEST(Core, Union_Closure_Membership_Sees_Through_Nesting_And_Aliases) {
+    TypeDefinitionsRegister type_register(project_with_nested_union_defs);
+    EXPECT_TRUE(type_register.is_union_member(number_or_bool_type, TypeSignatureFactory::Float));
+    EXPECT_TRUE(type_register.is_union_member(number_or_bool_type, TypeSignatureFactory::Bool));
+    EXPECT_TRUE(type_register.is_union_member(number_or_bool_type, flag_type));
+    EXPECT_FALSE(type_register.is_union_member(number_or_bool_type, TypeSignatureFactory::String));
+    EXPECT_FALSE(type_register.is_union_member(TypeSignatureFactory::Int, TypeSignatureFactory::Int));
+}
+
+TEST(Core, Union_Closure_Subset_Queries) {
+    TypeDefinitionsRegister type_register(project_with_nested_union_defs);
+    EXPECT_TRUE(type_register.is_union_subset(number_type, number_or_bool_type));
+    EXPECT_TRUE(type_register.is_union_subset(TypeSignatureFactory::IntOrFloat, number_type));
+    EXPECT_FALSE(type_register.is_union_subset(number_or_bool_type, number_type));
+    EXPECT_FALSE(type_register.is_union_subset(TypeSignatureFactory::Int, number_type));
+}
+
+TEST(Core, Union_Closure_Does_Not_Answer_For_Generic_Members) {
+    TypeDefinitionsRegister type_register(project_with_nested_union_defs);
+    EXPECT_FALSE(type_register.is_union_member(TypeSignatureFactory::TorU, TypeSignatureFactory::T));
+    EXPECT_FALSE(type_register.is_union_subset(TypeSignatureFactory::TorU, TypeSignatureFactory::TorU));
+}
\ No newline at end of file
@@ -116,4 +116,34 @@ TEST(Frontend, Parse_Two_Binary_Operators_rotation_blocked_with_parenthesis) {
     EXPECT_EQ(leftop.left_operand.get<IntLiteral>().value, 1);
     EXPECT_EQ(leftop.right_operand.get<IntLiteral>().value, 2);
     EXPECT_EQ(parentop.right_operand.get<IntLiteral>().value, 3);
+}
+
+TEST(Frontend, Parse_Mixed_Priority_Binary_Operators_Chain_Is_Left_Associative) {
+    std::vector<Token> tokens = {
+        { "a", "test.basalt", 1, 1, 1, Token::Type::text },
+        { "-", "test.basalt", 1, 2, 2, Token::Type::symbol },
+        { "b", "test.basalt", 1, 3, 3, Token::Type::text },
+        { "*", "test.basalt", 1, 4, 4, Token::Type::symbol },
+        { "c", "test.basalt", 1, 5, 5, Token::Type::text },
+        { "-", "test.basalt", 1, 6, 6, Token::Type::symbol },
+        { "d", "test.basalt", 1, 7, 7, Token::Type::text },
+        { "<", "test.basalt", 1, 8, 8, Token::Type::symbol },
+        { "e", "test.basalt", 1, 9, 9, Token::Type::text },
+    };
+    Parser parser = Parser({ "inline-tests.basalt", tokens });
+    Expression expr = parser.parse_expression();
+    ASSERT_TRUE(expr.is<BinaryOperator>());
+    const BinaryOperator& comparison = expr.get<BinaryOperator>();
+    EXPECT_EQ(comparison.operator_text, "<");
+    EXPECT_TRUE(comparison.right_operand.is<Identifier>());
+    ASSERT_TRUE(comparison.left_operand.is<BinaryOperator>());
+    const BinaryOperator& outer_subtraction = comparison.left_operand.get<BinaryOperator>();
+    EXPECT_EQ(outer_subtraction.operator_text, "-");
+    EXPECT_TRUE(outer_subtraction.right_operand.is<Identifier>());
+    ASSERT_TRUE(outer_subtraction.left_operand.is<BinaryOperator>());
+    const BinaryOperator& inner_subtraction = outer_subtraction.left_operand.get<BinaryOperator>();
+    EXPECT_EQ(inner_subtraction.operator_text, "-");
+    EXPECT_TRUE(inner_subtraction.left_operand.is<Identifier>());
+    ASSERT_TRUE(inner_subtraction.right_operand.is<BinaryOperator>());
+    EXPECT_EQ(inner_subtraction.right_operand.get<BinaryOperator>().operator_text, "*");
 }
\ No newline at end of file
@@ -72,4 +72,23 @@ TEST(Frontend, Parse_Dot_Member_Access_Array_Square_Brackets_Access_And_Pointer_
     const DotMemberAccess& dot_member_access = square_brackets_access.storage.get<DotMemberAccess>();
     EXPECT_TRUE(dot_member_access.struct_value.is<Identifier>());
     EXPECT_EQ(dot_member_access.member_name, "b");
+}
+
+TEST(Frontend, Parse_Dot_Member_Access_On_Expression_Wrapped_In_Parenthesis) {
+    std::vector<Token> tokens = {
+        { "(", "test.basalt", 1, 1, 1, Token::Type::symbol },
+        { "a", "test.basalt", 1, 2, 2, Token::Type::text },
+        { "+", "test.basalt", 1, 3, 3, Token::Type::symbol },
+        { "b", "test.basalt", 1, 4, 4, Token::Type::text },
+        { ")", "test.basalt", 1, 5, 5, Token::Type::symbol },
+        { ".", "test.basalt", 1, 6, 6, Token::Type::symbol },
+        { "c", "test.basalt", 1, 7, 7, Token::Type::text },
+    };
+    Parser parser = Parser({ "inline-tests.basalt", tokens });
+    Expression expr = parser.parse_expression();
+    ASSERT_TRUE(expr.is<DotMemberAccess>());
+    const DotMemberAccess& dot_member_access = expr.get<DotMemberAccess>();
+    EXPECT_EQ(dot_member_access.member_name, "c");
+    ASSERT_TRUE(dot_member_access.struct_value.is<BinaryOperator>());
+    EXPECT_TRUE(dot_member_access.struct_value.is_wrapped_in_in_parenthesis());
 }
\ No newline at end of file
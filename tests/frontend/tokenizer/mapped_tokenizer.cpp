@@ -0,0 +1,67 @@
+
+#include <gtest/gtest.h>
+#include "frontend/tokenizer.hpp"
+#include "frontend/mapped_tokenizer.hpp"
+#include "errors/internal_errors.hpp"
+
+static void expect_same_tokens_as_tokenizer(const std::string& inline_input) {
+    SourceFilesRegistry source_files_registry;
+    SourceFilesRegistry::FileId file_id = source_files_registry.store_inline_input("inline input token stream", inline_input);
+    std::vector<Token> expected = Tokenizer(std::istringstream(inline_input)).tokenize().tokens;
+    std::vector<Token> actual = MappedTokenizer(source_files_registry, file_id).tokenize().tokens;
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(actual[i].sourcetext, expected[i].sourcetext);
+        EXPECT_EQ(actual[i].type, expected[i].type);
+        EXPECT_EQ(actual[i].filename, expected[i].filename);
+        EXPECT_EQ(actual[i].line_number, expected[i].line_number);
+        EXPECT_EQ(actual[i].tok_number, expected[i].tok_number);
+        EXPECT_EQ(actual[i].char_pos, expected[i].char_pos);
+    }
+}
+
+TEST(Frontend, Mapped_Tokenizer_Produces_Views_Into_The_Source_Text) {
+    SourceFilesRegistry source_files_registry;
+    SourceFilesRegistry::FileId file_id = source_files_registry.store_inline_input("inline", "var x : Int = 16;");
+    std::string_view source_text = source_files_registry.get_source_text(file_id);
+    std::vector<TokenView> tokens = MappedTokenizer(source_files_registry, file_id).tokenize_as_views();
+    ASSERT_EQ(tokens.size(), 7);
+    EXPECT_EQ(tokens[0].sourcetext, "var");
+    EXPECT_EQ(tokens[2].sourcetext, ":");
+    EXPECT_EQ(tokens[3].sourcetext, "Int");
+    EXPECT_EQ(tokens[5].sourcetext, "16");
+    EXPECT_EQ(tokens[3].type, Token::Type::type);
+    EXPECT_EQ(tokens[5].type, Token::Type::integer_literal);
+    for (const TokenView& token : tokens) {
+        EXPECT_EQ(token.file_id, file_id);
+        EXPECT_GE(token.sourcetext.data(), source_text.data());
+        EXPECT_LE(token.sourcetext.data() + token.sourcetext.size(), source_text.data() + source_text.size());
+    }
+}
+
+TEST(Frontend, Mapped_Tokenizer_Matches_Tokenizer_On_Declarations) {
+    expect_same_tokens_as_tokenizer("func main() -> Int {\n\tvar x : [4] Float = [4] Float {1.5, 2.0, 3, 4};\n\treturn 0;\n}\n");
+}
+
+TEST(Frontend, Mapped_Tokenizer_Matches_Tokenizer_On_Operators_And_Literals) {
+    expect_same_tokens_as_tokenizer("if (a <= b && c != 'x' || !d) { s = \"he said \\\"hi\\\"\"; p = &q; }");
+}
+
+TEST(Frontend, Mapped_Tokenizer_Matches_Tokenizer_On_Comments) {
+    expect_same_tokens_as_tokenizer("16 /*/* \n \tcomment \n */ */17 // trailing\n18\r\n/**/19");
+}
+
+TEST(Frontend, Mapped_Tokenizer_Matches_Tokenizer_On_Empty_Lines_And_Input) {
+    expect_same_tokens_as_tokenizer("");
+    expect_same_tokens_as_tokenizer("\n\n\n x \n\n");
+}
+
+TEST(Frontend, Mapped_Tokenizer_Rejects_Unclosed_Strings_And_Comments) {
+    SourceFilesRegistry source_files_registry;
+    SourceFilesRegistry::FileId unclosed_string = source_files_registry.store_inline_input("inline", "x = \"hello;");
+    SourceFilesRegistry::FileId unclosed_comment = source_files_registry.store_inline_input("inline", "x /* = 4;");
+    SourceFilesRegistry::FileId multiple_points = source_files_registry.store_inline_input("inline", "x = 4.5.6;");
+    EXPECT_ANY_THROW(std::ignore = MappedTokenizer(source_files_registry, unclosed_string).tokenize_as_views());
+    EXPECT_ANY_THROW(std::ignore = MappedTokenizer(source_files_registry, unclosed_comment).tokenize_as_views());
+    EXPECT_ANY_THROW(std::ignore = MappedTokenizer(source_files_registry, multiple_points).tokenize_as_views());
+}
\ No newline at end of file
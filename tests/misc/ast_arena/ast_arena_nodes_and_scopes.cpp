@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "misc/ast_arena.hpp"
+#include "frontend/token.hpp"
+#include "language/functions.hpp"
+#include "language/expressions.hpp"
+#include "language/statements.hpp"
+
+struct LiveNodesCounter {
+    enum class Kind { counted_node };
+
+    template<typename Implementation>
+    static constexpr Kind kind_tag_of = Kind::counted_node;
+
+    inline static size_t alive_nodes = 0;
+};
+
+struct CountedNode : public LiveNodesCounter {
+    CountedNode() { alive_nodes++; }
+    CountedNode(const CountedNode&) { alive_nodes++; }
+    ~CountedNode() { alive_nodes--; }
+    bool is_generic() const { return false; }
+};
+
+TEST(Misc, Ast_Arena_Function_Call_Is_Tagged_Both_As_Expression_And_As_Statement) {
+    FunctionCall function_call { Token { "f", "test.basalt", 1, 1, 1, Token::Type::text }, { }, { } };
+    Expression expression = function_call;
+    Statement statement = function_call;
+    EXPECT_TRUE(expression.is<FunctionCall>());
+    EXPECT_FALSE(expression.is<Identifier>());
+    EXPECT_EQ(expression.expression_kind(), ExpressionBody::Kind::function_call);
+    EXPECT_TRUE(statement.is<FunctionCall>());
+    EXPECT_FALSE(statement.is<Return>());
+    EXPECT_EQ(statement.statement_kind(), StatementBody::Kind::function_call);
+    EXPECT_EQ(expression.get<FunctionCall>().function_name, "f");
+    EXPECT_EQ(statement.get<FunctionCall>().function_name, "f");
+}
+
+TEST(Misc, Ast_Arena_Copies_Of_An_Expression_Share_The_Same_Node) {
+    Expression original = Identifier { Token { "x", "test.basalt", 1, 1, 1, Token::Type::text } };
+    Expression copy = original;
+    copy.get<Identifier>().name = "y";
+    EXPECT_EQ(&original.get<Identifier>(), &copy.get<Identifier>());
+    EXPECT_EQ(original.get<Identifier>().name, "y");
+}
+
+TEST(Misc, Ast_Arena_Scope_Makes_Nodes_Live_In_The_Arena_Only_While_Alive) {
+    AstArena ast_arena;
+    EXPECT_FALSE(AstArena::is_in_use_by_current_thread());
+    {
+        AstArena::Scope ast_arena_scope(ast_arena);
+        EXPECT_TRUE(AstArena::is_in_use_by_current_thread());
+        EXPECT_EQ(ast_arena.get_reserved_bytes(), 0);
+        Expression inner_expression = Identifier { Token { "inner", "test.basalt", 1, 1, 1, Token::Type::text } };
+        EXPECT_GT(ast_arena.get_reserved_bytes(), 0);
+        EXPECT_EQ(inner_expression.get<Identifier>().name, "inner");
+    }
+    EXPECT_FALSE(AstArena::is_in_use_by_current_thread());
+    size_t reserved_bytes = ast_arena.get_reserved_bytes();
+    Expression outer_expression = Identifier { Token { "outer", "test.basalt", 1, 1, 1, Token::Type::text } };
+    EXPECT_EQ(ast_arena.get_reserved_bytes(), reserved_bytes);
+    EXPECT_EQ(outer_expression.get<Identifier>().name, "outer");
+}
+
+TEST(Misc, Ast_Arena_Nodes_Built_Outside_Any_Arena_Are_Released_With_Their_Last_Handle) {
+    LiveNodesCounter::alive_nodes = 0;
+    {
+        Polymorph<LiveNodesCounter> first_handle = CountedNode { };
+        {
+            Polymorph<LiveNodesCounter> second_handle = first_handle;
+            EXPECT_EQ(&first_handle.get<CountedNode>(), &second_handle.get<CountedNode>());
+        }
+        EXPECT_EQ(LiveNodesCounter::alive_nodes, 1);
+    }
+    EXPECT_EQ(LiveNodesCounter::alive_nodes, 0);
+}
+
+TEST(Misc, Ast_Arena_Destroys_Its_Nodes_When_The_Compilation_Ends) {
+    LiveNodesCounter::alive_nodes = 0;
+    {
+        AstArena ast_arena;
+        {
+            AstArena::Scope ast_arena_scope(ast_arena);
+            Polymorph<LiveNodesCounter> handle = CountedNode { };
+        }
+        EXPECT_EQ(LiveNodesCounter::alive_nodes, 1);
+    }
+    EXPECT_EQ(LiveNodesCounter::alive_nodes, 0);
+}
\ No newline at end of file
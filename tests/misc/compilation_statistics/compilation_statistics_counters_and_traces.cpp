@@ -0,0 +1,52 @@
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "misc/compilation_statistics.hpp"
+
+TEST(Misc, Compilation_Statistics_Counters_Are_Accumulated) {
+    CompilationStatistics::reset();
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::tokens, 40);
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::tokens, 2);
+    CompilationStatistics::increment_counter(CompilationStatistics::Counter::generic_instantiations);
+    EXPECT_EQ(CompilationStatistics::get_counter(CompilationStatistics::Counter::tokens), 42);
+    EXPECT_EQ(CompilationStatistics::get_counter(CompilationStatistics::Counter::generic_instantiations), 1);
+    EXPECT_EQ(CompilationStatistics::get_counter(CompilationStatistics::Counter::llvm_functions_emitted), 0);
+    CompilationStatistics::reset();
+    EXPECT_EQ(CompilationStatistics::get_counter(CompilationStatistics::Counter::tokens), 0);
+}
+
+TEST(Misc, Compilation_Statistics_Phases_Are_Exported_As_Chrome_Trace_Events) {
+    CompilationStatistics::reset();
+    {
+        ScopedPhaseTimer phase_timer("Tokenizer", "main.bt");
+    }
+    {
+        ScopedPhaseTimer phase_timer("Parser", "\"quoted\".bt");
+    }
+    std::stringstream chrome_trace;
+    CompilationStatistics::write_chrome_trace(chrome_trace);
+    std::string trace_text = chrome_trace.str();
+    EXPECT_EQ(trace_text.rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace_text.find("\"name\":\"Tokenizer\""), std::string::npos);
+    EXPECT_NE(trace_text.find("\"detail\":\"main.bt\""), std::string::npos);
+    EXPECT_NE(trace_text.find("\"detail\":\"\\\"quoted\\\".bt\""), std::string::npos);
+    EXPECT_NE(trace_text.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace_text.find("\"tokens\":0"), std::string::npos);
+    std::stringstream summary;
+    CompilationStatistics::print_summary(summary);
+    EXPECT_NE(summary.str().find("Parser"), std::string::npos);
+    CompilationStatistics::reset();
+}
+
+TEST(Misc, Compilation_Statistics_Control_Characters_Are_Escaped_In_Chrome_Trace_Events) {
+    CompilationStatistics::reset();
+    {
+        ScopedPhaseTimer phase_timer("Parser", std::string("a\r\t\b\f\x01\x1f.bt"));
+    }
+    std::stringstream chrome_trace;
+    CompilationStatistics::write_chrome_trace(chrome_trace);
+    std::string trace_text = chrome_trace.str();
+    EXPECT_NE(trace_text.find("\"detail\":\"a\\r\\t\\b\\f\\u0001\\u001f.bt\""), std::string::npos);
+    EXPECT_EQ(trace_text.find('\r'), std::string::npos);
+    CompilationStatistics::reset();
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 struct TypeSignatureFactory {
 
     inline static const TypeSignature Int       = PrimitiveType{ Token { int_type,       "test.basalt", 1, 1, 3, Token::Type::type}   };
+    inline static const TypeSignature Int32     = PrimitiveType{ Token { int32_type,     "test.basalt", 1, 1, 5, Token::Type::type}   };
     inline static const TypeSignature Float     = PrimitiveType{ Token { float_type,     "test.basalt", 1, 1, 5, Token::Type::type}   };
     inline static const TypeSignature String    = PrimitiveType{ Token { string_type,    "test.basalt", 1, 1, 6, Token::Type::type}   };
     inline static const TypeSignature Bool      = PrimitiveType{ Token { bool_type,      "test.basalt", 1, 1, 4, Token::Type::type}   };